@@ -550,7 +550,7 @@ static REBARR *Startup_Natives(const REBVAL *boot_natives)
     // the INTEGER! word must be bound to its datatype.  Deep walk the
     // natives in order to bind these datatypes.
     //
-    Bind_Values_Deep(item, Lib_Context);
+    Bind_Values_Deep(VAL_ARRAY(boot_natives), 0, Lib_Context);
 
     REBARR *catalog = Make_Array(Num_Natives);
 
@@ -614,7 +614,9 @@ static REBARR *Startup_Generics(const REBVAL *boot_generics)
     // context, so there is a variable for each action.  This means that the
     // assignments can execute.
     //
-    Bind_Values_Set_Midstream_Shallow(head, Lib_Context);
+    Bind_Values_Set_Midstream_Shallow(
+        VAL_ARRAY(boot_generics), 0, Lib_Context
+    );
 
     // The above actually does bind the GENERIC word to the GENERIC native,
     // since the GENERIC word is found in the top-level of the block.  But as
@@ -622,7 +624,7 @@ static REBARR *Startup_Generics(const REBVAL *boot_generics)
     // INTEGER! word must be bound to its datatype.  Deep bind the code in
     // order to bind the words for these datatypes.
     //
-    Bind_Values_Deep(head, Lib_Context);
+    Bind_Values_Deep(VAL_ARRAY(boot_generics), 0, Lib_Context);
 
     DECLARE_LOCAL (result);
     if (Do_Any_Array_At_Throws(result, boot_generics, SPECIFIED))
@@ -811,7 +813,7 @@ static void Init_System_Object(
     REBCTX *errors_catalog
 ) {
     assert(VAL_INDEX(boot_sysobj_spec) == 0);
-    RELVAL *spec_head = VAL_ARRAY_AT(boot_sysobj_spec);
+    REBARR *spec = VAL_ARRAY(boot_sysobj_spec);
 
     // Create the system object from the sysobj block (defined in %sysobj.r)
     //
@@ -821,11 +823,11 @@ static void Init_System_Object(
         NULL // parent
     );
 
-    Bind_Values_Deep(spec_head, Lib_Context);
+    Bind_Values_Deep(spec, 0, Lib_Context);
 
     // Bind it so CONTEXT native will work (only used at topmost depth)
     //
-    Bind_Values_Shallow(spec_head, system);
+    Bind_Values_Shallow(spec, 0, system);
 
     // Evaluate the block (will eval CONTEXTs within).  Expects void result.
     //
@@ -950,6 +952,13 @@ void Startup_Task(void)
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
 
+    TG_Shape_Version = 1;  // cache entries with shape 0 are never valid
+    CLEAR(TG_Override_Cache, sizeof(TG_Override_Cache));
+    CLEAR(TG_Key_Cache, sizeof(TG_Key_Cache));
+    CLEAR(TG_Parse_Programs, sizeof(TG_Parse_Programs));
+    TG_Parse_Program_Tick = 0;
+    CLEAR(TG_Scan_Cache, sizeof(TG_Scan_Cache));
+
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
 
@@ -1020,8 +1029,6 @@ void Startup_Task(void)
 //
 static void Startup_Base(REBARR *boot_base)
 {
-    RELVAL *head = ARR_HEAD(boot_base);
-
     // By this point, the Lib_Context contains basic definitions for things
     // like true, false, the natives, and the generics.  But before deeply
     // binding the code in the base block to those definitions, add all the
@@ -1032,12 +1039,12 @@ static void Startup_Base(REBARR *boot_base)
     // for FOO to bind to.  So FOO: would be an unbound SET-WORD!,
     // and give an error on the assignment.
     //
-    Bind_Values_Set_Midstream_Shallow(head, Lib_Context);
+    Bind_Values_Set_Midstream_Shallow(boot_base, 0, Lib_Context);
 
     // With the base block's definitions added to the mix, deep bind the code
     // and execute it.
 
-    Bind_Values_Deep(head, Lib_Context);
+    Bind_Values_Deep(boot_base, 0, Lib_Context);
 
     DECLARE_LOCAL (result);
     if (Do_At_Mutable_Throws(result, boot_base, 0, SPECIFIED))
@@ -1064,15 +1071,13 @@ static void Startup_Base(REBARR *boot_base)
 // done by delegating it to Rebol can use a function in sys as a service.
 //
 static void Startup_Sys(REBARR *boot_sys) {
-    RELVAL *head = ARR_HEAD(boot_sys);
-
     // Add all new top-level SET-WORD! found in the sys boot-block to Lib,
     // and then bind deeply all words to Lib and Sys.  See Startup_Base() notes
     // for why the top-level walk is needed first.
     //
-    Bind_Values_Set_Midstream_Shallow(head, Sys_Context);
-    Bind_Values_Deep(head, Lib_Context);
-    Bind_Values_Deep(head, Sys_Context);
+    Bind_Values_Set_Midstream_Shallow(boot_sys, 0, Sys_Context);
+    Bind_Values_Deep(boot_sys, 0, Lib_Context);
+    Bind_Values_Deep(boot_sys, 0, Sys_Context);
 
     DECLARE_LOCAL (result);
     if (Do_At_Mutable_Throws(result, boot_sys, 0, SPECIFIED))
@@ -1453,6 +1458,7 @@ void Shutdown_Core(void)
     Shutdown_CRC();
     Shutdown_String();
     Shutdown_Scanner();
+    Shutdown_Parse();
     Shutdown_Char_Cases();
 
     Shutdown_Api();
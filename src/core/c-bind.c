@@ -83,6 +83,7 @@ void Bind_Values_Inner_Loop(
             (ANY_ARRAY_OR_PATH_KIND(kind))
             and (flags & BIND_DEEP)
         ){
+            Remember_Series(SER(VAL_ARRAY(cell)));  // bindings are nodes
             Bind_Values_Inner_Loop(
                 binder,
                 VAL_ARRAY_AT(cell),
@@ -99,20 +100,30 @@ void Bind_Values_Inner_Loop(
 //
 //  Bind_Values_Core: C
 //
-// Bind words in an array of values terminated with END
-// to a specified context.  See warnings on the functions like
-// Bind_Values_Deep() about not passing just a singular REBVAL.
+// Bind words in an array of values terminated with END, starting at the
+// given index, to a specified context.
 //
 // NOTE: If types are added, then they will be added in "midstream".  Only
 // bindings that come after the added value is seen will be bound.
 //
+// The array may have survived a recycle, so it goes through the write
+// barrier like the arrays nested in it do.  (See Remember_Series())  That's
+// why this takes the array and not a pointer to the first cell...so it also
+// has to do the past-the-tail check VAL_ARRAY_AT() did for the callers.
+//
 void Bind_Values_Core(
-    RELVAL *head,
+    REBARR *array,
+    REBCNT index,
     REBCTX *context,
     REBU64 bind_types,
     REBU64 add_midstream_types,
     REBFLGS flags // see %sys-core.h for BIND_DEEP, etc.
 ) {
+    if (index > ARR_LEN(array))
+        fail (Error_Past_End_Raw());  // e.g. BIND on a block that was cleared
+
+    Remember_Series(SER(array));  // bindings are nodes
+
     struct Reb_Binder binder;
     INIT_BINDER(&binder);
 
@@ -120,14 +131,19 @@ void Bind_Values_Core(
     // is done by poking the index into the REBSER of the series behind the
     // ANY-WORD!, so it must be cleaned up to not break future bindings.)
 
-    REBCNT index = 1;
+    REBCNT n = 1;
     REBVAL *key = CTX_KEYS_HEAD(context);
-    for (; index <= CTX_LEN(context); key++, index++)
+    for (; n <= CTX_LEN(context); key++, n++)
         if (not Is_Param_Unbindable(key))
-            Add_Binder_Index(&binder, VAL_KEY_CANON(key), index);
+            Add_Binder_Index(&binder, VAL_KEY_CANON(key), n);
 
     Bind_Values_Inner_Loop(
-        &binder, head, context, bind_types, add_midstream_types, flags
+        &binder,
+        ARR_AT(array, index),
+        context,
+        bind_types,
+        add_midstream_types,
+        flags
     );
 
     // Reset all the binder indices to zero, balancing out what was added.
@@ -148,9 +164,18 @@ void Bind_Values_Core(
 // bound to a particular target (if target is NULL, then all
 // words will be unbound regardless of their VAL_WORD_CONTEXT).
 //
-void Unbind_Values_Core(RELVAL *head, REBCTX *context, bool deep)
-{
-    RELVAL *v = head;
+void Unbind_Values_Core(
+    REBARR *array,
+    REBCNT index,
+    REBCTX *context,
+    bool deep
+){
+    if (index > ARR_LEN(array))
+        fail (Error_Past_End_Raw());  // see Bind_Values_Core()
+
+    Remember_Series(SER(array));  // see Bind_Values_Core()
+
+    RELVAL *v = ARR_AT(array, index);
     for (; NOT_END(v); ++v) {
         if (
             ANY_WORD(v)
@@ -159,7 +184,7 @@ void Unbind_Values_Core(RELVAL *head, REBCTX *context, bool deep)
             Unbind_Any_Word(v);
         }
         else if (ANY_ARRAY_OR_PATH(v) and deep)
-            Unbind_Values_Core(VAL_ARRAY_AT(v), context, true);
+            Unbind_Values_Core(VAL_ARRAY(v), VAL_INDEX(v), context, true);
     }
 }
 
@@ -312,6 +337,7 @@ void Rebind_Values_Deep(
     RELVAL *v = head;
     for (; NOT_END(v); ++v) {
         if (ANY_ARRAY_OR_PATH(v)) {
+            Remember_Series(SER(VAL_ARRAY(v)));  // bindings are nodes
             Rebind_Values_Deep(src, dst, VAL_ARRAY_AT(v), opt_binder);
         }
         else if (ANY_WORD(v) and VAL_BINDING(v) == NOD(src)) {
@@ -632,10 +658,11 @@ void Virtual_Bind_Deep_To_New_Context(
 
     if (not duplicate) {
         //
-        // This is effectively `Bind_Values_Deep(ARR_HEAD(body_out), context)`
+        // This is effectively `Bind_Values_Deep(body_array, index, context)`
         // but we want to reuse the binder we had anyway for detecting the
         // duplicates.
         //
+        Remember_Series(SER(VAL_ARRAY(body_in_out)));  // bindings are nodes
         Bind_Values_Inner_Loop(
             &binder, VAL_ARRAY_AT(body_in_out), c, TS_WORD, 0, BIND_DEEP
         );
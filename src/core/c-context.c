@@ -104,7 +104,7 @@ REBCTX *Alloc_Context_Core(enum Reb_Kind kind, REBCNT capacity, REBFLGS flags)
 
     // Default the ancestor link to be to this keylist itself.
     //
-    LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+    INIT_LINK_ANCESTOR(keylist, keylist);
 
     // varlists link keylists via LINK().keysource, sharable hence managed
 
@@ -149,9 +149,9 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBCNT delta)
         // concerned, though they can still run against ancestor methods.
         //
         if (LINK_ANCESTOR(keylist) == keylist)
-            LINK_ANCESTOR_NODE(copy) = NOD(copy);
+            INIT_LINK_ANCESTOR(copy, copy);
         else
-            LINK_ANCESTOR_NODE(copy) = LINK_ANCESTOR_NODE(keylist);
+            INIT_LINK_ANCESTOR(copy, LINK_ANCESTOR(keylist));
 
         Manage_Array(copy);
         INIT_CTX_KEYLIST_UNIQUE(context, copy);
@@ -166,6 +166,7 @@ bool Expand_Context_Keylist_Core(REBCTX *context, REBCNT delta)
     // context, and no INIT_CTX_KEYLIST_SHARED was used by another context
     // to mark the flag indicating it's shared.  Extend it directly.
 
+    ++TG_Shape_Version;  // see Is_Overriding_Context()
     Extend_Series(SER(keylist), delta);
     TERM_ARRAY_LEN(keylist, ARR_LEN(keylist));
 
@@ -299,7 +300,7 @@ REBCTX *Copy_Context_Shallow_Extra_Managed(REBCTX *src, REBCNT extra) {
 
         dest = CTX(varlist);
 
-        LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(src));
+        INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(src));
 
         INIT_CTX_KEYLIST_UNIQUE(dest, keylist);
     }
@@ -756,6 +757,7 @@ void Rebind_Context_Deep(
     REBCTX *dest,
     struct Reb_Binder *opt_binder
 ) {
+    Remember_Series(SER(CTX_VARLIST(dest)));  // see Bind_Values_Core()
     Rebind_Values_Deep(source, dest, CTX_VARS_HEAD(dest), opt_binder);
 }
 
@@ -813,7 +815,7 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     //
     if (opt_parent == NULL) {
         INIT_CTX_KEYLIST_UNIQUE(context, keylist);
-        LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+        INIT_LINK_ANCESTOR(keylist, keylist);
     }
     else {
         if (keylist == CTX_KEYLIST(opt_parent)) {
@@ -826,7 +828,7 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
         }
         else {
             INIT_CTX_KEYLIST_UNIQUE(context, keylist);
-            LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(opt_parent));
+            INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(opt_parent));
         }
     }
 
@@ -907,20 +909,20 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
 //
 REBCTX *Construct_Context_Managed(
     enum Reb_Kind kind,
-    RELVAL *head, // !!! Warning: modified binding
+    REBARR *array, // !!! Warning: modified binding
+    REBCNT index,
     REBSPC *specifier,
     REBCTX *opt_parent
 ) {
+    RELVAL *head = ARR_AT(array, index);
+
     REBCTX *context = Make_Selfish_Context_Detect_Managed(
         kind, // type
         head, // values to scan for toplevel set-words
         opt_parent // parent
     );
 
-    if (not head)
-        return context;
-
-    Bind_Values_Shallow(head, context);
+    Bind_Values_Shallow(array, index, context);
 
     const RELVAL *value = head;
     for (; NOT_END(value); value += 2) {
@@ -1057,9 +1059,9 @@ REBCTX *Merge_Contexts_Selfish_Managed(REBCTX *parent1, REBCTX *parent2)
     Init_Unreadable_Blank(ARR_HEAD(keylist)); // Currently no rootkey usage
 
     if (parent1 == NULL)
-        LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+        INIT_LINK_ANCESTOR(keylist, keylist);
     else
-        LINK_ANCESTOR_NODE(keylist) = NOD(CTX_KEYLIST(parent1));
+        INIT_LINK_ANCESTOR(keylist, CTX_KEYLIST(parent1));
 
     REBARR *varlist = Make_Array_Core(
         ARR_LEN(keylist),
@@ -1312,6 +1314,44 @@ REBCNT Find_Canon_In_Context(REBCTX *context, REBSTR *canon, bool always)
 }
 
 
+//
+//  Find_Canon_In_Context_Cached: C
+//
+// Same as Find_Canon_In_Context() without `always`, but it first checks the
+// index that was found last time for this keylist and name (see notes on
+// `struct Reb_Key_Cache`).  Used by path dispatch, where the same fields of
+// the same kinds of objects tend to be picked over and over.
+//
+REBCNT Find_Canon_In_Context_Cached(REBCTX *context, REBSTR *canon)
+{
+    REBNOD *keylist = NOD(CTX_KEYLIST(context));
+    struct Reb_Key_Cache *entry = &TG_Key_Cache[
+        (
+            (cast(uintptr_t, keylist) >> 4) * 31
+                + (cast(uintptr_t, canon) >> 4)
+        ) & (KEY_CACHE_SIZE - 1)
+    ];
+
+    if (entry->keylist == keylist and entry->canon == canon) {
+        REBCNT n = entry->index;
+        if (n <= CTX_LEN(context)) {
+            REBVAL *key = CTX_KEY(context, n);
+            if (VAL_KEY_CANON(key) == canon)
+                return Is_Param_Unbindable(key) ? 0 : n;
+        }
+    }
+
+    const bool always = false;
+    REBCNT n = Find_Canon_In_Context(context, canon, always);
+    if (n != 0) {
+        entry->keylist = keylist;
+        entry->canon = canon;
+        entry->index = n;
+    }
+    return n;
+}
+
+
 //
 //  Select_Canon_In_Context: C
 //
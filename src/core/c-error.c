@@ -560,7 +560,7 @@ REB_R MAKE_Error(
         Init_Error(out, error);
 
         Rebind_Context_Deep(root_error, error, NULL); // NULL=>no more binds
-        Bind_Values_Deep(VAL_ARRAY_AT(arg), error);
+        Bind_Values_Deep(VAL_ARRAY(arg), VAL_INDEX(arg), error);
 
         DECLARE_LOCAL (evaluated);
         if (Do_Any_Array_At_Throws(evaluated, arg, SPECIFIED)) {
@@ -1383,7 +1383,8 @@ REBCTX *Startup_Errors(const REBVAL *boot_errors)
     assert(VAL_INDEX(boot_errors) == 0);
     REBCTX *catalog = Construct_Context_Managed(
         REB_OBJECT,
-        VAL_ARRAY_AT(boot_errors),
+        VAL_ARRAY(boot_errors),
+        VAL_INDEX(boot_errors),
         VAL_SPECIFIER(boot_errors),
         NULL
     );
@@ -1395,7 +1396,8 @@ REBCTX *Startup_Errors(const REBVAL *boot_errors)
     for (val = CTX_VAR(catalog, SELFISH(1)); NOT_END(val); val++) {
         REBCTX *error = Construct_Context_Managed(
             REB_OBJECT,
-            VAL_ARRAY_HEAD(val),
+            VAL_ARRAY(val),
+            0,
             SPECIFIED, // source array not in a function body
             NULL
         );
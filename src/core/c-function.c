@@ -1691,9 +1691,9 @@ REB_R Encloser_Dispatcher(REBFRM *f)
 
     // f->varlist may or may not have wound up being managed.  It was not
     // allocated through the usual mechanisms, so if unmanaged it's not in
-    // the tracking list Init_Any_Context() expects.  Just fiddle the bit.
+    // the tracking list Init_Any_Context() expects.  So just set the bit.
     //
-    SET_SERIES_FLAG(c, MANAGED);
+    Manage_Untracked_Series(SER(c));
 
     // When the DO of the FRAME! executes, we don't want it to run the
     // encloser again (infinite loop).
@@ -1713,7 +1713,7 @@ REB_R Encloser_Dispatcher(REBFRM *f)
     // Note that since varlists aren't added to the manual series list, the
     // bit must be tweaked vs. using Ensure_Array_Managed.
     //
-    SET_SERIES_FLAG(f->varlist, MANAGED);
+    Manage_Untracked_Series(SER(f->varlist));
 
     const bool fully = true;
     if (RunQ_Throws(f->out, fully, rebU1(outer), rootvar, rebEND))
@@ -545,8 +545,8 @@ REBCTX *Resolve_Path(const REBVAL *path, REBCNT *index_out)
         return NULL; // !!! does not handle single-element paths
 
     while (ANY_CONTEXT(var) and IS_WORD(picker)) {
-        REBCNT i = Find_Canon_In_Context(
-            VAL_CONTEXT(var), VAL_WORD_CANON(picker), false
+        REBCNT i = Find_Canon_In_Context_Cached(
+            VAL_CONTEXT(var), VAL_WORD_CANON(picker)
         );
         ++picker;
         if (IS_END(picker)) {
@@ -102,6 +102,8 @@ bool Do_Signals_Throws(REBVAL *out)
         CLR_SIGNAL(SIG_RECYCLE);
         Recycle();
     }
+    else if (GC_Marking)
+        Recycle();  // next step of incremental recycle, even with ballast
 
 #ifdef NOT_USED_INVESTIGATE
     if (filtered_sigs & SIG_EVENT_PORT) {  // !!! Why not used?
@@ -300,6 +300,7 @@ bool Specialize_Action_Throws(
 
         // See Bind_Values_Core() for explanations of how the binding works.
 
+        Remember_Series(SER(VAL_ARRAY(opt_def)));  // bindings are nodes
         Bind_Values_Inner_Loop(
             &binder,
             VAL_ARRAY_AT(opt_def),
@@ -1056,7 +1057,7 @@ bool Make_Frame_From_Varargs_Throws(
 
     INIT_LINK_KEYSOURCE(exemplar, NOD(act));
 
-    SET_SERIES_FLAG(f->varlist, MANAGED); // is inaccessible
+    Manage_Untracked_Series(SER(f->varlist)); // is inaccessible
     f->varlist = nullptr; // just let it GC, for now
 
     // May not be at end or thrown, e.g. (x: does lit y x = 'y)
@@ -1068,7 +1069,7 @@ bool Make_Frame_From_Varargs_Throws(
     // managed, but Push_Action() does not use ordinary series creation to
     // make its nodes, so manual ones don't wind up in the tracking list.
     //
-    SET_SERIES_FLAG(exemplar, MANAGED); // can't use Manage_Series
+    Manage_Untracked_Series(SER(exemplar)); // can't use Manage_Series
 
     Init_Frame(out, exemplar);
     return false;
@@ -90,6 +90,21 @@ REBINT Get_Hash_Prime(REBCNT size)
 }
 
 
+// The table of canons has the hash of each canon's spelling next to the
+// pointer to it.  So probing it only looks at a spelling when the hashes
+// match, and expanding it doesn't need to hash anything again.  Its size is
+// a power of 2, so the first slot to look in is just the low bits of the
+// hash, and collisions go on to try the next slot.
+//
+struct Reb_Canon_Slot {
+    REBSTR *canon;  // nullptr if slot never used, DELETED_CANON if freed
+    uint32_t hash;
+};
+
+#define CANON_SLOTS() \
+    SER_HEAD(struct Reb_Canon_Slot, PG_Canons_By_Hash)
+
+
 // Removals from linear probing lists can be complex, because the same
 // overflow slot may be visited through different initial hashes:
 //
@@ -103,12 +118,31 @@ static REBSTR PG_Deleted_Canon;
 #define DELETED_CANON &PG_Deleted_Canon
 
 
+// The canon table's load factor policy.  At most half of its slots may be in
+// use, counting the DELETED_CANON ones (they make probes longer just as live
+// canons do).  When adding a canon would go past that, the table is rebuilt
+// without the deleted slots, at a size where the live canons fill no more
+// than half of that limit.  That's the same size if enough of the slots in
+// use were deleted ones, or else it's doubled.  Either way, at least as many
+// canons as are live can be added before the next rebuild.
+//
+#define CANON_TABLE_MAX_USE(num_slots) \
+    ((num_slots) / 2)
+
+#define CANON_TABLE_FULL(num_in_use,num_slots) \
+    ((num_in_use) + 1 > CANON_TABLE_MAX_USE(num_slots))
+
+#define CANON_TABLE_CROWDED(num_live,num_slots) \
+    ((num_live) + 1 > CANON_TABLE_MAX_USE(num_slots) / 2)
+
+
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
-// the current table.  Free the old hash array.
+// Rebuild the hash table part of the word_table, moving all the canons of
+// the current table into a new one (which drops any deleted slots).  It's
+// the next power of 2 size unless the table isn't CANON_TABLE_CROWDED() by
+// live canons.  Free the old hash array.
 //
 static void Expand_Word_Table(void)
 {
@@ -116,30 +150,48 @@ static void Expand_Word_Table(void)
     // Hold onto it while creating the new hash table.
 
     REBCNT old_num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *old_canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
+    struct Reb_Canon_Slot *old_slots = CANON_SLOTS();
+
+    // If enough of the slots in use are deleted ones, then moving the canons
+    // into a table of the same size will clean those out.
+    //
+  #if defined(NDEBUG)
+    REBCNT num_deleteds = 0;
+    REBCNT old_slot;
+    for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
+        if (old_slots[old_slot].canon == DELETED_CANON)
+            ++num_deleteds;
+    }
+  #else
+    REBCNT num_deleteds = PG_Num_Canon_Deleteds;
+  #endif
 
-    REBCNT num_slots = Get_Hash_Prime(old_num_slots + 1);
-    if (num_slots == 0) { // larger than hash prime table
-        DECLARE_LOCAL (temp);
-        Init_Integer(temp, old_num_slots + 1);
-        fail (Error_Size_Limit_Raw(temp));
+    REBCNT num_live = PG_Num_Canon_Slots_In_Use - num_deleteds;
+
+    REBCNT num_slots = old_num_slots;
+    if (CANON_TABLE_CROWDED(num_live, old_num_slots)) {
+        if (old_num_slots > INT32_MAX / 2) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, cast(REBI64, old_num_slots) * 2);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+        num_slots = old_num_slots * 2;
     }
 
-    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(REBSTR*));
+    assert(SER_WIDE(PG_Canons_By_Hash) == sizeof(struct Reb_Canon_Slot));
 
     REBSER *ser = Make_Series_Core(
-        num_slots, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
+        num_slots, sizeof(struct Reb_Canon_Slot), SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(ser);
     SET_SERIES_LEN(ser, num_slots);
 
-    // Rehash all the symbols:
-
-    REBSTR **new_canons_by_hash = SER_HEAD(REBSTR*, ser);
+    struct Reb_Canon_Slot *new_slots = SER_HEAD(struct Reb_Canon_Slot, ser);
+    REBCNT mask = num_slots - 1;
 
-    REBCNT old_slot;
-    for (old_slot = 0; old_slot != old_num_slots; ++old_slot) {
-        REBSTR *canon = old_canons_by_hash[old_slot];
+    REBCNT n;
+    for (n = 0; n != old_num_slots; ++n) {
+        REBSTR *canon = old_slots[n].canon;
         if (not canon)
             continue;
 
@@ -151,19 +203,10 @@ static void Expand_Word_Table(void)
             continue;
         }
 
-        REBCNT skip;
-        REBCNT slot = First_Hash_Candidate_Slot(
-            &skip,
-            Hash_String(canon),
-            num_slots
-        );
-
-        while (new_canons_by_hash[slot]) { // skip occupied slots
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
-        }
-        new_canons_by_hash[slot] = canon;
+        REBCNT slot = old_slots[n].hash & mask;
+        while (new_slots[slot].canon) // skip occupied slots
+            slot = (slot + 1) & mask;
+        new_slots[slot] = old_slots[n];
     }
 
     Free_Unmanaged_Series(PG_Canons_By_Hash);
@@ -186,6 +229,11 @@ static void Expand_Word_Table(void)
 // one "canon" interning to use for fast case-insensitive compares.  If that
 // canon form is GC'd, the agreed upon canon for the group will change.
 //
+// !!! The table takes no locks, so only the evaluating thread may intern.
+// Making it safe for other threads would buy nothing yet: the REBSTR series
+// come from the memory pools and are tracked by the GC, and neither of those
+// can be used by more than one thread either.
+//
 REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 {
     // The hashing technique used is called "linear probing":
@@ -194,47 +242,52 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     //
     // For the hash search to be guaranteed to terminate, the table must be
     // large enough that we are able to find a NULL if there's a miss.  (It's
-    // actually kept larger than that, but to be on the right side of theory,
-    // the table is always checked for expansion needs *before* the search.)
+    // actually kept larger than that, see CANON_TABLE_MAX_USE().  But to be
+    // on the right side of theory, the table is always checked for expansion
+    // needs *before* the search.)
     //
     REBCNT num_slots = SER_LEN(PG_Canons_By_Hash);
-    if (PG_Num_Canon_Slots_In_Use > num_slots / 2) {
+    if (CANON_TABLE_FULL(PG_Num_Canon_Slots_In_Use, num_slots)) {
         Expand_Word_Table();
-        num_slots = SER_LEN(PG_Canons_By_Hash); // got larger
+        num_slots = SER_LEN(PG_Canons_By_Hash); // larger, or no deleteds
     }
 
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
+    struct Reb_Canon_Slot *slots = CANON_SLOTS();
+    REBCNT mask = num_slots - 1;
 
-    REBCNT skip; // how many slots to skip when occupied candidates found
-    REBCNT slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_UTF8(utf8, size),
-        num_slots
-    );
+    uint32_t hash = cast(uint32_t, Hash_UTF8(utf8, size));
+    REBCNT slot = hash & mask;
 
-    // The hash table only indexes the canon form of each spelling.  So when
-    // testing a slot to see if it's a match (or a collision that needs to
-    // be skipped to try again) the search uses a comparison that is
-    // case-insensitive...but reports if synonyms via > 0 results.
+    // The hash table only indexes the canon form of each spelling, and the
+    // hash is case-insensitive.  So a slot whose hash matches may hold the
+    // canon of an alternate casing ("synonym") of the string we're interning
+    // as well as the same spelling.  The same spelling is by far the most
+    // common, so it's checked for before the case-insensitive comparison.
     //
-    REBSTR **deleted_slot = nullptr;
+    struct Reb_Canon_Slot *deleted_slot = nullptr;
     REBSTR* canon;
-    while ((canon = canons_by_hash[slot])) {
+    while ((canon = slots[slot].canon)) {
         if (canon == DELETED_CANON) {
-            deleted_slot = &canons_by_hash[slot];
+            if (not deleted_slot)
+                deleted_slot = &slots[slot];
             goto next_candidate_slot;
         }
 
+        if (slots[slot].hash != hash)
+            goto next_candidate_slot;  // can't be any casing of the string
+
         assert(GET_SERIES_INFO(canon, STRING_CANON));
 
-        blockscope {
-            REBINT cmp = Compare_UTF8(STR_HEAD(canon), utf8, size);
-            if (cmp == 0)
-                return canon;  // was a case-sensitive match
-            if (cmp < 0)
-                goto next_candidate_slot;  // wasn't an alternate casing
+        if (
+            STR_SIZE(canon) == size
+            and memcmp(STR_HEAD(canon), utf8, size) == 0
+        ){
+            return canon;  // was a case-sensitive match
         }
 
+        if (Compare_UTF8(STR_HEAD(canon), utf8, size) < 0)
+            goto next_candidate_slot;  // wasn't an alternate casing
+
         // The > 0 result means that the canon word that was found is an
         // alternate casing ("synonym") for the string we're interning.  The
         // synonyms are attached to the canon form with a circularly linked
@@ -245,11 +298,14 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
             while (synonym != canon) {
                 assert(NOT_SERIES_INFO(synonym, STRING_CANON));
 
-                REBINT cmp = Compare_UTF8(STR_HEAD(synonym), utf8, size);
-                if (cmp == 0)
+                if (
+                    STR_SIZE(synonym) == size
+                    and memcmp(STR_HEAD(synonym), utf8, size) == 0
+                ){
                     return synonym;  // exact match means no new interning
+                }
 
-                assert(cmp > 0);  // at least a synonym if in this list
+                assert(Compare_UTF8(STR_HEAD(synonym), utf8, size) > 0);
                 synonym = LINK_SYNONYM(synonym);  // look until cycle
             }
         }
@@ -258,9 +314,7 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 
       next_candidate_slot:  // https://en.wikipedia.org/wiki/Linear_probing
 
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
+        slot = (slot + 1) & mask;
     }
 
     assert(not canon);  // loop exits when it finds a vacant canon slot
@@ -308,13 +362,15 @@ REBSTR *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
         // Startup_Symbols() tags values from %words.r after the fact.
 
         if (deleted_slot) {
-            *deleted_slot = STR(s);  // reuse the deleted slot
+            deleted_slot->canon = STR(s);  // reuse the deleted slot
+            deleted_slot->hash = hash;
           #if !defined(NDEBUG)
             --PG_Num_Canon_Deleteds;  // note slot usage count stays constant
           #endif
         }
         else {
-            canons_by_hash[slot] = STR(s);
+            slots[slot].canon = STR(s);
+            slots[slot].hash = hash;
             ++PG_Num_Canon_Slots_In_Use;
         }
     }
@@ -373,57 +429,49 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(MISC(intern).bind_index.high == 0);  // shouldn't GC during binds?
     assert(MISC(intern).bind_index.low == 0);
 
-    REBCNT num_slots = SER_LEN(PG_Canons_By_Hash);
-    REBSTR* *canons_by_hash = SER_HEAD(REBSTR*, PG_Canons_By_Hash);
+    REBCNT mask = SER_LEN(PG_Canons_By_Hash) - 1;
+    struct Reb_Canon_Slot *slots = CANON_SLOTS();
 
-    REBCNT skip;
-    REBCNT slot = First_Hash_Candidate_Slot(
-        &skip,
-        Hash_String(intern),
-        num_slots
-    );
+    uint32_t hash = cast(uint32_t, Hash_String(intern));
+    REBCNT slot = hash & mask;
 
     // We *will* find the canon form in the hash table.
     //
-    while (canons_by_hash[slot] != intern) {
-        slot += skip;
-        if (slot >= num_slots)
-            slot -= num_slots;
-    }
+    while (slots[slot].canon != intern)
+        slot = (slot + 1) & mask;
+
+    assert(slots[slot].hash == hash);
 
     if (synonym != intern) {
         //
         // If there was a synonym in the circularly linked list distinct from
         // the canon form, then it gets a promotion to being the canon form.
-        // It should hash the same, and be able to take over the hash slot.
+        // It hashes the same, and is able to take over the hash slot.
         //
     #ifdef SLOW_INTERN_HASH_DOUBLE_CHECK
-        assert(hash == Hash_String(synonym));
+        assert(hash == cast(uint32_t, Hash_String(synonym)));
     #endif
-        canons_by_hash[slot] = synonym;
+        slots[slot].canon = synonym;
         SET_SERIES_INFO(synonym, STRING_CANON);
         MISC(synonym).bind_index.low = 0;
         MISC(synonym).bind_index.high = 0;
     }
-    else {
-        // This canon form must be removed from the hash table.  Ripple the
-        // collision slots back until a NULL is found, to reduce search times.
+    else if (not slots[(slot + 1) & mask].canon) {
         //
-        REBCNT previous_slot = slot;
-        while (canons_by_hash[slot]) {
-            slot += skip;
-            if (slot >= num_slots)
-                slot -= num_slots;
-            canons_by_hash[previous_slot] = canons_by_hash[slot];
-        }
-
+        // No probe goes on past a slot followed by a vacant one, so this one
+        // can just be made vacant too.
+        //
+        slots[slot].canon = nullptr;
+        --PG_Num_Canon_Slots_In_Use;
+    }
+    else {
         // Signal that the hash slot is "deleted" via a special pointer.
-        // See notes on DELETED_SLOT for why the final slot in the collision
-        // chain can't just be left NULL:
+        // See notes on DELETED_CANON for why the slot can't just be left
+        // NULL when probes may go on past it:
         //
         // http://stackoverflow.com/a/279812/211160
         //
-        canons_by_hash[previous_slot] = DELETED_CANON;
+        slots[slot].canon = DELETED_CANON;
 
     #if !defined(NDEBUG)
         ++PG_Num_Canon_Deleteds; // total use same (PG_Num_Canons_Or_Deleteds)
@@ -472,9 +520,9 @@ void Startup_Interning(void)
     PG_Num_Canon_Deleteds = 0;
 #endif
 
-    // Start hash table out at a fixed size.  When collisions occur, it
-    // causes a skipping pattern that continues until it finds the desired
-    // slot.  The method is known as linear probing:
+    // Start hash table out at a fixed size.  When collisions occur, the
+    // following slots are tried until it finds the desired one.  The method
+    // is known as linear probing:
     //
     // https://en.wikipedia.org/wiki/Linear_probing
     //
@@ -483,15 +531,17 @@ void Startup_Interning(void)
     // reduce long probing chains, it should be significantly larger than that.
     // R3-Alpha used a heuristic of 4 times as big as the number of words.
 
+    // The size must be a power of 2.
+
     REBCNT n;
 #if defined(NDEBUG)
-    n = Get_Hash_Prime(WORD_TABLE_SIZE * 4); // extra reduces rehashing
+    n = WORD_TABLE_SIZE * 4; // extra reduces rehashing
 #else
     n = 1; // forces exercise of rehashing logic in debug build
 #endif
 
     PG_Canons_By_Hash = Make_Series_Core(
-        n, sizeof(REBSTR*), SERIES_FLAG_POWER_OF_2
+        n, sizeof(struct Reb_Canon_Slot), SERIES_FLAG_POWER_OF_2
     );
     Clear_Series(PG_Canons_By_Hash); // all slots start at NULL
     SET_SERIES_LEN(PG_Canons_By_Hash, n);
@@ -608,7 +658,7 @@ void Shutdown_Interning(void)
 
         REBCNT slot;
         for (slot = 0; slot < SER_LEN(PG_Canons_By_Hash); ++slot) {
-            REBSTR *canon = *SER_AT(REBSTR*, PG_Canons_By_Hash, slot);
+            REBSTR *canon = CANON_SLOTS()[slot].canon;
             if (canon and canon != DELETED_CANON)
                 panic (canon);
         }
@@ -34,8 +34,15 @@
 
 #if !defined(NDEBUG)
 
+// A minor recycle doesn't mark series that are old, it stops at them.  And
+// an incremental recycle colors series with info bits instead of marking.
+//
 #define Is_Marked(n) \
-    (SER(n)->header.bits & NODE_FLAG_MARKED)
+    ((SER(n)->header.bits & NODE_FLAG_MARKED) \
+        or (GC_Minor and (SER(n)->info.bits & SERIES_INFO_SCANNED)) \
+        or (GC_Marking and (SER(n)->info.bits & ( \
+            SERIES_INFO_SCANNED | SERIES_INFO_REMEMBERED \
+        ))))
 
 
 //
@@ -48,7 +55,9 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
     if (KIND_BYTE_UNCHECKED(v) == REB_QUOTED) {
         assert(GET_CELL_FLAG(v, FIRST_IS_NODE));
         assert(MIRROR_BYTE(v) == REB_QUOTED);
-        assert(Is_Marked(PAYLOAD(Any, v).first.node));
+        assert(  // incremental steps don't mark pairings until the end
+            Is_Marked(PAYLOAD(Any, v).first.node) or GC_Marking
+        );
         return;
     }
     enum Reb_Kind kind = CELL_KIND_UNCHECKED(cast(const REBCEL*, v));
@@ -129,7 +138,7 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
 
       case REB_PAIR: {
         REBVAL *paired = VAL(VAL_NODE(v));
-        assert(Is_Marked(paired));
+        assert(Is_Marked(paired) or GC_Marking);  // see above
         break; }
 
       case REB_TUPLE:
@@ -226,17 +235,16 @@ void Assert_Cell_Marked_Correctly(const RELVAL *v)
         assert(Is_Marked(s));
 
         if (not IS_STR_SYMBOL(STR(s))) {
-            REBBMK *bookmark = LINK(s).bookmarks;
-            if (bookmark) {
-                assert(not LINK(bookmark).bookmarks);  // just one for now
+            REBBMK *bookmarks = LINK(s).bookmarks;
+            if (bookmarks) {
                 //
-                // The intent is that bookmarks are unmanaged REBSERs, which
-                // get freed when the string GCs.  This mechanic could be a by
-                // product of noticing that the SERIES_INFO_LINK_IS_NODE is
+                // The intent is that bookmarks are an unmanaged array, which
+                // gets freed when the string GCs.  This mechanic could be a
+                // by product of noticing that SERIES_INFO_LINK_IS_NODE is
                 // true but that the managed bit on the node is false.
 
-                assert(not Is_Marked(bookmark));
-                assert(NOT_SERIES_FLAG(bookmark, MANAGED));
+                assert(not Is_Marked(bookmarks));
+                assert(NOT_SERIES_FLAG(bookmarks, MANAGED));
             }
         }
         break; }
@@ -34,10 +34,12 @@
 //
 //  {Provides status and statistics information about the interpreter.}
 //
-//      return: [<opt> time! integer!]
+//      return: [<opt> time! integer! object! block!]
 //      /show "Print formatted results to console"
 //      /profile "Returns profiler object"
 //      /evals "Number of values evaluated by interpreter"
+//      /recycling "Returns object describing automatic recycling"
+//      /pools "Width, segments, requests, wasted, magazine nodes of each pool"
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -51,6 +53,47 @@ REBNATIVE(stats)
         return Init_Integer(D_OUT, n);
     }
 
+    if (REF(recycling)) {
+        //
+        // ballast: bytes between automatic recycles
+        // growth: ballast as percent of live memory (0 means fixed)
+        // live: bytes in use after last recycle
+        // survival: percent allocated since prior recycle kept by it
+        // released: bytes of pool segments given back after recycles
+        //
+        REBVAL *obj = rebValue("make object! [",
+            "ballast:", rebI(TG_Ballast),
+            "growth:", rebI(GC_Growth),
+            "live:", rebI(GC_Live_Bytes),
+            "survival:", rebI(GC_Survival),
+            "released:", rebI(GC_Released),
+        "]", rebEND);
+
+        Move_Value(D_OUT, obj);
+        rebRelease(obj);
+        return D_OUT;
+    }
+
+    if (REF(pools)) {  // requests and wasted are counted while RECYCLE/TUNE
+        REBARR *a = Make_Array(MAX_POOLS * 5);
+        REBCNT n;
+        for (n = 0; n != MAX_POOLS; ++n) {
+            REBPOL *pool = &Mem_Pools[n];
+
+            REBCNT segs = 0;
+            REBSEG *seg;
+            for (seg = pool->segs; seg != nullptr; seg = seg->next)
+                ++segs;
+
+            Init_Integer(Alloc_Tail_Array(a), pool->wide);
+            Init_Integer(Alloc_Tail_Array(a), segs);
+            Init_Integer(Alloc_Tail_Array(a), pool->requests);
+            Init_Integer(Alloc_Tail_Array(a), pool->wasted);
+            Init_Integer(Alloc_Tail_Array(a), TG_Magazines[n].count);
+        }
+        return Init_Block(D_OUT, a);
+    }
+
 #ifdef NDEBUG
     UNUSED(REF(show));
     UNUSED(REF(profile));
@@ -69,6 +69,47 @@ REBNATIVE(test_librebol)
     intptr_t getter = rebUnboxInteger("api-transient {Hello}", rebEND);
     Init_Logic(DS_PUSH(), rebDidQ("{Hello} =", cast(void*, getter), rebEND));
 
+    // A fragment seen again comes from the scan cache, but what it makes has
+    // to be new each time.  A fragment that leaves an array open to be
+    // closed by a later one can't be cached.
+    //
+    Init_Integer(DS_PUSH(), 3);
+    REBVAL *blocks[3];
+    int i;
+    for (i = 0; i < 3; ++i)
+        blocks[i] = rebValue("[a {b}]", rebEND);
+    rebElide("append", blocks[0], "1", rebEND);
+    Init_Logic(
+        DS_PUSH(),
+        rebDid(
+            "all [[a {b} 1] =", blocks[0], "[a {b}] =", blocks[2], "]",
+            rebEND
+        )
+    );
+    for (i = 0; i < 3; ++i)
+        rebRelease(blocks[i]);
+
+    Init_Integer(DS_PUSH(), 4);
+    bool split_ok = true;
+    for (i = 0; i < 3; ++i) {
+        if (not rebDid("[1 2] = [", rebI(1), "2]", rebEND))
+            split_ok = false;
+    }
+    Init_Logic(DS_PUSH(), split_ok);
+
+    // Fragments after the first one are cached too, and a lone fragment
+    // with no series in it is walked in the cache without being copied.
+    //
+    Init_Integer(DS_PUSH(), 5);
+    bool cached_ok = true;
+    for (i = 0; i < 3; ++i) {
+        if (rebUnboxInteger("1 +", rebI(2), "+ 3", rebEND) != 6)
+            cached_ok = false;
+        if (rebUnboxInteger("10 + 20", rebEND) != 30)
+            cached_ok = false;
+    }
+    Init_Logic(DS_PUSH(), cached_ok);
+
     return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
   #endif
 }
@@ -350,17 +350,11 @@ REBCNT Modify_String_Or_Binary(
                 // adding (whereas AS has to worry about the *whole* binary
                 // for aliasing, since BACK and HEAD are still possible)
                 //
-                src_len_raw = 0;
-                REBSIZ bytes_left = src_size_raw;
-                const REBYTE *bp = src_ptr;
-                for (; bytes_left > 0; --bytes_left, ++bp) {
-                    REBUNI c = *bp;
-                    if (c >= 0x80) {
-                        bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-                        if (not bp)  // !!! Should Back_Scan() fail?
-                            fail (Error_Bad_Utf8_Raw());
-                    }
-                    ++src_len_raw;
+                if (
+                    Check_UTF8(&src_len_raw, src_ptr, src_size_raw)
+                    != src_size_raw
+                ){
+                    fail (Error_Bad_Utf8_Raw());
                 }
             }
         }
@@ -448,22 +442,14 @@ REBCNT Modify_String_Or_Binary(
         src_len_total = src_len_raw * dups;
     }
 
-    REBBMK *bookmark = nullptr;
-    if (IS_SER_STRING(dst_ser))
-        bookmark = LINK(dst_ser).bookmarks;
-
-    // For strings, we should have generated a bookmark in the process of this
-    // modification in most cases where the size is notable.  If we had not,
-    // we might add a new bookmark pertinent to the end of the insertion for
-    // longer series.
-
     if (sym == SYM_APPEND or sym == SYM_INSERT) {  // always expands
         Expand_Series(dst_ser, dst_off, src_size_total);
         SET_SERIES_USED(dst_ser, dst_used + src_size_total);
 
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) >= dst_idx)  // only INSERT
-                BMK_OFFSET(bookmark) += src_size_total;
+            Update_Bookmarks(  // only INSERT has any bookmarks to shift
+                STR(dst_ser), dst_idx, 0, src_len_total, src_size_total
+            );
             MISC(dst_ser).length = dst_len_old + src_len_total;
         }
     }
@@ -541,15 +527,17 @@ REBCNT Modify_String_Or_Binary(
         }
 
         // CHANGE can do arbitrary changes to what index maps to what offset
-        // in the region of interest.  The manipulations here would be
-        // complicated--but just assume that the start of the change is as
-        // good a cache as any to be relevant for the next operation.
+        // in the region of interest, so bookmarks inside it are dropped.
+        // Those after it just shift.
         //
         if (IS_SER_STRING(dst_ser)) {
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {
-                BMK_INDEX(bookmark) = dst_idx;
-                BMK_OFFSET(bookmark) = dst_off;
-            }
+            Update_Bookmarks(
+                STR(dst_ser),
+                dst_idx,
+                cast(REBCNT, part),
+                src_len_total,
+                cast(REBINT, src_size_total) - cast(REBINT, part_size)
+            );
             MISC(dst_ser).length = dst_len_old + src_len_total - part;
         }
     }
@@ -573,19 +561,13 @@ REBCNT Modify_String_Or_Binary(
     if (mo->series != nullptr)  // ...a Push_Mold() happened
         Drop_Mold(mo);
 
-    if (bookmark) {
-        if (BMK_INDEX(bookmark) > STR_LEN(STR(dst_ser))) {  // past active
-            assert(sym == SYM_CHANGE);  // only change removes material
-            Free_Bookmarks_Maybe_Null(STR(dst_ser));
-        }
-        else {
-          #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
-            Check_Bookmarks_Debug(dst_ser);
-          #endif
+    if (IS_SER_STRING(dst_ser) and LINK(dst_ser).bookmarks) {
+      #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
+        Check_Bookmarks_Debug(STR(dst_ser));
+      #endif
 
-            if (STR_LEN(STR(dst_ser)) < sizeof(REBVAL))  // not kept if small
-                Free_Bookmarks_Maybe_Null(STR(dst_ser));
-        }
+        if (STR_LEN(STR(dst_ser)) < sizeof(REBVAL))  // not kept if small
+            Free_Bookmarks_Maybe_Null(STR(dst_ser));
     }
 
     ASSERT_SERIES_TERM(dst_ser);
@@ -736,6 +736,209 @@ static REBCTX *Error_Mismatch(SCAN_STATE *ss, char wanted, char seen) {
 }
 
 
+//
+// Big files of data spend much of their scanning time skipping whitespace
+// (indentation in particular), comments, and the bodies of words.  When the
+// compiler targets an x86 with SSE2, runs of those bytes are classified 16
+// at a time.
+//
+// Input is only known to end at a '\0' byte, so the loads are aligned on 16
+// byte boundaries.  They may read a few bytes past the terminator, but an
+// aligned load can't cross into another memory page so it won't fault.
+// Address sanitizer builds can't know that, so they don't use the vectors.
+//
+// The vector tests only recognize part of some lexical classes (ASCII
+// letters and digits and UTF-8 bytes for words, but not `?` or `!`).  The
+// byte-at-a-time test takes over at the first byte outside of that part, so
+// vector loops only decide where a run *might* end.
+//
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #define SCAN_SSE2
+    #include <emmintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+
+    #if defined(__SANITIZE_ADDRESS__)
+        #undef SCAN_SSE2
+    #elif defined(__has_feature)
+        #if __has_feature(address_sanitizer)
+            #undef SCAN_SSE2
+        #endif
+    #endif
+#endif
+
+// Most tokens (and gaps between tokens) are short, and for those the setup
+// of a vector loop costs more than it saves.
+//
+#define SCAN_SSE2_AFTER 16
+
+enum Reb_Lex_Run {
+    LEX_RUN_SPACE,  // IS_LEX_SPACE(), so not newlines
+    LEX_RUN_WORD,  // IS_LEX_WORD_OR_NUMBER()
+    LEX_RUN_NUMBER,  // IS_LEX_NUMBER()
+    LEX_RUN_LINE  // everything up to CR, LF, or the end
+};
+
+inline static bool In_Lex_Run(REBYTE b, enum Reb_Lex_Run run) {
+    switch (run) {
+      case LEX_RUN_SPACE:
+        return IS_LEX_SPACE(b);
+      case LEX_RUN_WORD:
+        return IS_LEX_WORD_OR_NUMBER(b);
+      case LEX_RUN_NUMBER:
+        return IS_LEX_NUMBER(b);
+      case LEX_RUN_LINE:
+        return not ANY_CR_LF_END(b);
+    }
+    DEAD_END;
+}
+
+#if defined(SCAN_SSE2)
+
+// Bits set for bytes the vector test can tell are in the run.  The '\0' at
+// the end of the input is never one of them.
+//
+inline static uint32_t Lex_Run_Mask_Sse2(__m128i v, enum Reb_Lex_Run run)
+{
+    __m128i in;
+    switch (run) {
+      case LEX_RUN_SPACE: {  // control codes and space, less CR and LF
+        in = _mm_and_si128(
+            _mm_cmpgt_epi8(v, _mm_setzero_si128()),
+            _mm_cmplt_epi8(v, _mm_set1_epi8(' ' + 1))
+        );
+        in = _mm_andnot_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(LF)),
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(CR))
+            ),
+            in
+        );
+        break; }
+
+      case LEX_RUN_WORD: {  // letters, digits, and UTF-8 C0 to F4 excepted
+        __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        in = _mm_or_si128(
+            _mm_and_si128(
+                _mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+                _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1))
+            ),
+            _mm_and_si128(
+                _mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1))
+            )
+        );
+        __m128i high = _mm_andnot_si128(  // signed, so 80 to BF is negative
+            _mm_cmpgt_epi8(v, _mm_set1_epi8(cast(char, 0xBF))),
+            _mm_cmplt_epi8(v, _mm_setzero_si128())
+        );
+        __m128i lead = _mm_and_si128(  // C2 to F4 start UTF-8 sequences
+            _mm_cmpgt_epi8(v, _mm_set1_epi8(cast(char, 0xC1))),
+            _mm_cmplt_epi8(v, _mm_set1_epi8(cast(char, 0xF5)))
+        );
+        in = _mm_or_si128(in, _mm_or_si128(high, lead));
+        break; }
+
+      case LEX_RUN_NUMBER:
+        in = _mm_and_si128(
+            _mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1))
+        );
+        break;
+
+      case LEX_RUN_LINE:
+        in = _mm_or_si128(
+            _mm_cmpeq_epi8(v, _mm_setzero_si128()),
+            _mm_or_si128(
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(LF)),
+                _mm_cmpeq_epi8(v, _mm_set1_epi8(CR))
+            )
+        );
+        return ~_mm_movemask_epi8(in) & 0xFFFF;
+    }
+    return _mm_movemask_epi8(in);
+}
+
+// Skip ahead to the first byte the vector test doesn't know to be in the run
+// (this might still be in it, so the caller has to check).
+//
+static const REBYTE *Skip_Lex_Run_Sse2(
+    const REBYTE *cp,
+    enum Reb_Lex_Run run
+){
+    uintptr_t offset = cast(uintptr_t, cp) & 15;
+    const REBYTE *bp = cp - offset;  // aligned, see notes above
+
+    uint32_t stop = ~Lex_Run_Mask_Sse2(
+        _mm_load_si128(cast(const __m128i*, bp)),
+        run
+    ) & (0xFFFF << offset) & 0xFFFF;
+
+    while (stop == 0) {
+        bp += 16;
+        stop = ~Lex_Run_Mask_Sse2(
+            _mm_load_si128(cast(const __m128i*, bp)),
+            run
+        ) & 0xFFFF;
+    }
+
+  #if defined(__GNUC__)
+    return bp + __builtin_ctz(stop);
+  #elif defined(_MSC_VER)
+    unsigned long n;
+    _BitScanForward(&n, stop);
+    return bp + n;
+  #else
+    REBCNT n = 0;
+    while (not (stop & 1)) {
+        stop >>= 1;
+        ++n;
+    }
+    return bp + n;
+  #endif
+}
+
+#endif
+
+
+// Advance past the bytes at `cp` that are in the given lexical run.
+//
+// Most runs are a byte or two long, so those are checked before anything
+// else.  Then bytes are tested four at a time, and after SCAN_SSE2_AFTER
+// more are found the vector loop is tried.
+//
+inline static const REBYTE *Skip_Lex_Run(
+    const REBYTE *cp,
+    enum Reb_Lex_Run run
+){
+  #if defined(SCAN_SSE2)
+    if (not In_Lex_Run(cp[0], run))
+        return cp;
+    if (not In_Lex_Run(cp[1], run))
+        return cp + 1;
+    cp += 2;
+
+    const REBYTE *limit = cp + SCAN_SSE2_AFTER;
+    while (
+        In_Lex_Run(cp[0], run) and In_Lex_Run(cp[1], run)
+        and In_Lex_Run(cp[2], run) and In_Lex_Run(cp[3], run)
+    ){
+        cp += 4;  // can't pass the '\0', as it's never in a run
+        if (cp == limit) {
+            cp = Skip_Lex_Run_Sse2(cp, run);
+            limit = cp + SCAN_SSE2_AFTER;
+        }
+    }
+  #endif
+
+    while (In_Lex_Run(*cp, run))
+        ++cp;
+    return cp;
+}
+
+
 //
 //  Prescan_Token: C
 //
@@ -769,8 +972,7 @@ static REBCNT Prescan_Token(SCAN_STATE *ss)
     const REBYTE *cp = ss->begin;
     REBCNT flags = 0;
 
-    while (IS_LEX_SPACE(*cp))  // skip whitespace (if any)
-        ++cp;
+    cp = Skip_Lex_Run(cp, LEX_RUN_SPACE);  // skip whitespace (if any)
     ss->begin = cp;  // don't count leading whitespace as part of token
 
     while (true) {
@@ -808,13 +1010,11 @@ static REBCNT Prescan_Token(SCAN_STATE *ss)
             // found, then a flag will be set indicating that also.
             //
             SET_LEX_FLAG(flags, LEX_SPECIAL_WORD);
-            while (IS_LEX_WORD_OR_NUMBER(*cp))
-                ++cp;
+            cp = Skip_Lex_Run(cp, LEX_RUN_WORD);
             break;
 
           case LEX_CLASS_NUMBER:
-            while (IS_LEX_NUMBER(*cp))
-                ++cp;
+            cp = Skip_Lex_Run(cp, LEX_RUN_NUMBER);
             break;
         }
     }
@@ -823,6 +1023,185 @@ static REBCNT Prescan_Token(SCAN_STATE *ss)
 }
 
 
+#define SCAN_CACHE_HASH(utf8) \
+    ((cast(uintptr_t, (utf8)) >> 4) & (SCAN_CACHE_SIZE - 1))
+
+static void Free_Scan_Cache(struct Reb_Scan_Cache *entry)
+{
+    if (entry->bytes) {
+        FREE_N(REBYTE, entry->size + 1, entry->bytes);
+        entry->bytes = nullptr;
+    }
+    entry->utf8 = nullptr;
+    entry->array = nullptr;  // the GC will free it if no feed is using it
+}
+
+
+// !!! The address of a fragment doesn't prove its text is what was cached (a
+// caller may reuse a buffer), so every lookup of a fragment whose address is
+// in the cache pays for a LEN_BYTES() and a memcmp() of it, hit or not.
+// That's far less than scanning it, but isn't free for long fragments.  A
+// fragment only seen once has no copy of its bytes yet, so only its length
+// can be checked...its bytes are copied before it's scanned, see below.
+//
+static bool Scan_Cache_Matches(
+    struct Reb_Scan_Cache *entry,
+    const REBYTE *utf8,
+    REBCTX *context
+){
+    return entry->utf8 == utf8
+        and entry->context == context
+        and entry->size == LEN_BYTES(utf8)
+        and (
+            not entry->bytes
+            or memcmp(entry->bytes, utf8, entry->size) == 0
+        );
+}
+
+
+//
+//  Did_Push_Cached_Fragment: C
+//
+// Called on each UTF-8 fragment of a variadic scan.  If what the fragment
+// scans to is in the scan cache, copies of the values are pushed and the
+// scan goes on from the va_list after it.  Series are cloned unless there
+// aren't any (e.g. `rebValue("[]")` is a new BLOCK! each time, which the
+// caller may modify).  A fragment is only copied, scanned on its own and
+// cached the second time it is seen; the first time, it just claims the
+// cache slot with its address and length.  So one-off fragments (e.g. built
+// in a buffer by the caller) cost a LEN_BYTES() and no allocation.
+//
+// Tokens don't cross the end of a fragment, so all that carries over from
+// one fragment to what follows is a pending newline...unless an array was
+// left open, e.g. `rebValue("[", value, "]")`.  Such a fragment fails to
+// scan on its own, and is marked not to try again.  A fragment in the middle
+// of a path might continue it, so isn't looked up.
+//
+// fail() panics until boot is done, so a fragment like the "[" in
+// `rebUnbox("switch", url, "[", ...)` can't be tried alone and rescued
+// then.  Boot doesn't use the cache.
+//
+static bool Did_Push_Cached_Fragment(SCAN_STATE *ss, const REBYTE *utf8)
+{
+    if (ss->mode_char == '/' or PG_Boot_Phase < BOOT_DONE)
+        return false;
+
+    REBCTX *context = ss->feed->context;
+    struct Reb_Scan_Cache *entry = &TG_Scan_Cache[SCAN_CACHE_HASH(utf8)];
+    if (not Scan_Cache_Matches(entry, utf8, context)) {
+        if (entry->utf8)
+            Free_Scan_Cache(entry);
+
+        entry->utf8 = utf8;
+        entry->context = context;
+        entry->size = LEN_BYTES(utf8);
+        entry->uncacheable = false;  // find out the next time it's seen
+        return false;
+    }
+
+    if (entry->uncacheable)
+        return false;
+
+    if (not entry->bytes) {  // second time it's been seen, so scan it alone
+        entry->bytes = ALLOC_N(REBYTE, entry->size + 1);
+        memcpy(entry->bytes, utf8, entry->size + 1);
+
+        REBDSP dsp_orig = DSP;
+
+        SCAN_STATE fragment = *ss;
+        fragment.mode_char = '\0';
+        fragment.begin = utf8;
+        fragment.newline_pending = false;
+        fragment.opts |= SCAN_FLAG_FRAGMENT;
+        if (not fragment.line_head)
+            fragment.line_head = fragment.start_line_head = utf8;
+
+        REBVAL *error = rebRescue(cast(REBDNG*, &Scan_To_Stack), &fragment);
+        if (error) {  // scan it with what follows to get the real error
+            rebRelease(error);
+            entry->uncacheable = true;
+            return false;
+        }
+
+        entry->array = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+        entry->newline_pending = fragment.newline_pending;
+        entry->lines = fragment.line - ss->line;
+
+        entry->shared = true;  // no series to clone, see Cached_Va_Array()
+        RELVAL *v = ARR_HEAD(entry->array);
+        for (; NOT_END(v); ++v) {
+            if (TS_CLONE & FLAGIT_KIND(VAL_TYPE(v)))
+                entry->shared = false;
+        }
+        if (entry->shared)
+            Deep_Freeze_Array(entry->array);
+    }
+
+    RELVAL *v = ARR_HEAD(entry->array);
+    if (ss->newline_pending and NOT_END(v)) {
+        Derelativize(DS_PUSH(), v, SPECIFIED);
+        SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        ss->newline_pending = false;
+        if (not entry->shared)
+            Clonify(DS_TOP, NODE_FLAG_MANAGED, TS_CLONE);
+        ++v;
+    }
+    for (; NOT_END(v); ++v) {
+        Derelativize(DS_PUSH(), v, SPECIFIED);
+        if (not entry->shared)
+            Clonify(DS_TOP, NODE_FLAG_MANAGED, TS_CLONE);
+    }
+
+    if (entry->newline_pending)
+        ss->newline_pending = true;
+    ss->line += entry->lines;
+    return true;
+}
+
+
+//
+//  Cached_Va_Array: C
+//
+// If a UTF-8 fragment is all a variadic feed has left (e.g. `rebValue("first
+// [a b c]", rebEND)`), and the values it scans to are cached without series
+// needing copies, the feed can walk the cached array itself.  That saves
+// pushing the values and managing a new array on each call.  The end is
+// then taken from the va_list; otherwise nullptr is returned and the
+// va_list is left as it was.
+//
+REBARR *Cached_Va_Array(struct Reb_Feed *feed, const REBYTE *utf8)
+{
+    struct Reb_Scan_Cache *entry = &TG_Scan_Cache[SCAN_CACHE_HASH(utf8)];
+    if (
+        entry->utf8 != utf8  // cheap tests before Scan_Cache_Matches()
+        or not entry->array
+        or not entry->shared
+        or ARR_LEN(entry->array) == 0
+    ){
+        return nullptr;
+    }
+
+  #if defined(va_copy)  // C99, a macro if <stdarg.h> has it
+    va_list peek;
+    va_copy(peek, *feed->vaptr);
+    const void *p = va_arg(peek, const void*);
+    va_end(peek);
+
+    if (not p or Detect_Rebol_Pointer(p) != DETECTED_AS_END)
+        return nullptr;
+
+    if (not Scan_Cache_Matches(entry, utf8, feed->context))
+        return nullptr;
+
+    p = va_arg(*feed->vaptr, const void*);  // take the end
+    return entry->array;
+  #else
+    UNUSED(feed);
+    return nullptr;  // can't look at the next pointer without taking it
+  #endif
+}
+
+
 //
 //  Locate_Token_May_Push_Mold: C
 //
@@ -925,6 +1304,9 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
         if (not ss->feed)  // not a variadic va_list-based scan...
             return TOKEN_END;  // ...so end of utf-8 input was *the* end
 
+        if (ss->opts & SCAN_FLAG_FRAGMENT)  // just one fragment to be cached
+            return TOKEN_END;  // ...see Scan_Va_To_Stack()
+
         const void *p = va_arg(*ss->feed->vaptr, const void*);
         if (not p or Detect_Rebol_Pointer(p) != DETECTED_AS_UTF8) {
             //
@@ -951,6 +1333,11 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
                 SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
             }
         }
+        else if (Did_Push_Cached_Fragment(ss, cast(const REBYTE*, p))) {
+            //
+            // What the UTF-8 scans to came from the scan cache, so go on to
+            // the next pointer in the va_list.
+        }
         else {  // It's UTF-8, so have to scan it ordinarily.
 
             ss->begin = cast(const REBYTE*, p);  // breaks the loop...
@@ -985,8 +1372,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
             panic ("Prescan_Token did not skip whitespace");
 
           case LEX_DELIMIT_SEMICOLON:  // ; begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Skip_Lex_Run(cp, LEX_RUN_LINE);
             if (*cp == '\0')
                 --cp;  // avoid passing EOF
             if (*cp == LF)
@@ -1576,8 +1962,7 @@ static REBINT Scan_Head(SCAN_STATE *ss)
     REBCNT count = ss->line;
 
     while (true) {
-        while (IS_LEX_SPACE(*cp))  // skip white space
-            ++cp;
+        cp = Skip_Lex_Run(cp, LEX_RUN_SPACE);  // skip white space
 
         switch (*cp) {
           case '[':
@@ -1612,8 +1997,7 @@ static REBINT Scan_Head(SCAN_STATE *ss)
                 rebol = bracket = nullptr;
 
           skipline:
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Skip_Lex_Run(cp, LEX_RUN_LINE);
             if (*cp == CR and cp[1] == LF)
                 ++cp;
             if (*cp != '\0')
@@ -2006,7 +2390,7 @@ REBVAL *Scan_To_Stack(SCAN_STATE *ss) {
             // just Lib_Context?  Not binding would break functions entirely,
             // but they can't round-trip anyway.  See #2262.
             //
-            Bind_Values_All_Deep(ARR_HEAD(array), Lib_Context);
+            Bind_Values_All_Deep(array, 0, Lib_Context);
 
             if (ARR_LEN(array) == 0 or not IS_WORD(ARR_HEAD(array))) {
                 DECLARE_LOCAL (temp);
@@ -2529,11 +2913,35 @@ static REBARR *Scan_Full_Array(SCAN_STATE *ss, REBYTE mode_char)
 }
 
 
+//
+//  Scan_Va_To_Stack: C
+//
+// Scan_To_Stack() for a variadic scan that starts on a UTF-8 fragment, which
+// may come from the scan cache like the fragments after it.
+//
+void Scan_Va_To_Stack(SCAN_STATE *ss)
+{
+    assert(ss->feed and ss->begin and not (ss->opts & SCAN_FLAG_FRAGMENT));
+
+    if (Did_Push_Cached_Fragment(ss, ss->begin))
+        ss->begin = nullptr;  // Locate_Token_May_Push_Mold() takes next va_arg
+
+    Scan_To_Stack(ss);
+}
+
+
 //
 //  Scan_UTF8_Managed: C
 //
 // Scan source code. Scan state initialized. No header required.
 //
+// !!! The whole input is scanned on the calling thread.  Scanning pieces of a
+// big input on other threads would need the memory pools, the data stack and
+// the symbol table (see Intern_UTF8_Managed()) to be thread-safe, and
+// construction syntax like `#[object! [...]]` can run code mid-scan.  Only
+// finding where the tokens are could be split off, and that's too small a
+// part of the work to pay for the threads.
+//
 REBARR *Scan_UTF8_Managed(REBSTR *filename, const REBYTE *utf8, REBSIZ size)
 {
     SCAN_STATE ss;
@@ -2606,6 +3014,11 @@ void Startup_Scanner(void)
 //
 void Shutdown_Scanner(void)
 {
+    REBCNT n;
+    for (n = 0; n < SCAN_CACHE_SIZE; ++n) {
+        if (TG_Scan_Cache[n].utf8)
+            Free_Scan_Cache(&TG_Scan_Cache[n]);
+    }
 }
 
 
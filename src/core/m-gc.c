@@ -64,6 +64,38 @@
 
 #include "sys-int-funcs.h"
 
+#if defined(USE_WORKER_THREADS)
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf()
+#endif
+
+
+// The sweep is split into finding the garbage (which only looks at the node
+// headers, and can be done by worker threads) and freeing it.  Garbage is
+// noted with a bit per node, see Find_Sweep_Garbage().
+//
+// (Thread globals like GC_Generational are copied into the job, so workers
+// don't depend on them.)
+//
+struct Reb_Sweep_Job {
+    REBSEG *seg;  // first of a run of SER_POOL segments
+    REBCNT num_segs;
+    bool tenure;  // generational, so live series become SERIES_INFO_SCANNED
+    bool scanned_live;  // incremental, so SERIES_INFO_SCANNED means reached
+    uintptr_t *dead;  // SWEEP_WORDS_PER_SEG() words for each segment
+    REBYTE *corrupt;  // first node found with a bad header byte, if any
+
+    REBNOD *freed;  // nodes released by a worker, see Release_Sweep_Garbage()
+    REBNOD *freed_last;
+    REBCNT num_freed;
+};
+
+#define SWEEP_BITS_PER_WORD \
+    (sizeof(uintptr_t) * 8)
+
+#define SWEEP_WORDS_PER_SEG(units) \
+    (((units) + SWEEP_BITS_PER_WORD - 1) / SWEEP_BITS_PER_WORD)
+
 
 //
 // !!! In R3-Alpha, the core included specialized structures which required
@@ -112,6 +144,54 @@ inline static void Queue_Mark_Value_Deep(const RELVAL *v)
 }
 
 
+// A minor recycle only sweeps the nursery, so the nodes it marks elsewhere
+// would keep NODE_FLAG_MARKED.  They're noted so Sweep_Nursery() can clear
+// their marks (and promote the series among them to the old generation).
+//
+inline static void Note_Minor_Mark(REBNOD *node)
+{
+    if (SER_FULL(GC_Minor_Marks))
+        Extend_Series(GC_Minor_Marks, 8);
+    *SER_AT(REBNOD*, GC_Minor_Marks, SER_USED(GC_Minor_Marks)) = node;
+    SET_SERIES_USED(GC_Minor_Marks, SER_USED(GC_Minor_Marks) + 1);
+}
+
+
+// An incremental recycle can't mark pairings until its final pause, so the
+// ones it reaches are listed.  See Queue_Mark_Pairing_Deep().
+//
+inline static void Note_Reached_Pairing(REBVAL *paired)
+{
+    if (SER_FULL(GC_Reached_Pairings))
+        Extend_Series(GC_Reached_Pairings, 8);
+    *SER_AT(REBVAL*, GC_Reached_Pairings, SER_USED(GC_Reached_Pairings))
+        = paired;
+    SET_SERIES_USED(
+        GC_Reached_Pairings,
+        SER_USED(GC_Reached_Pairings) + 1
+    );
+}
+
+
+// Submits the array into the deferred stack to be processed later with
+// Propagate_All_GC_Marks().  If it were not queued and just used recursion
+// (as R3-Alpha did) then deeply nested arrays could overflow the C stack.
+//
+// !!! Could the amount of C stack space available be used for some amount
+// of recursion, and only queue if running up against a limit?
+//
+// !!! Should this use a "bumping a NULL at the end" technique to grow, like
+// the data stack?
+//
+inline static void Push_Mark_Stack(REBARR *a)
+{
+    if (SER_FULL(GC_Mark_Stack))
+        Extend_Series(GC_Mark_Stack, 8);
+    *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = a;
+    SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);  // !term
+}
+
+
 // Ren-C's PAIR! uses a special kind of REBSER that does no additional memory
 // allocation, but embeds two REBVALs in the REBSER itself.  A REBVAL has a
 // uintptr_t header at the beginning of its struct, just like a REBSER, and
@@ -138,6 +218,11 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
     Queue_Mark_Opt_Value_Deep(paired);
     Queue_Mark_Opt_Value_Deep(PAIRING_KEY(paired));
 
+    // The mark bit on a cell aliases flags like CELL_FLAG_OUT_MARKED_STALE,
+    // so it can't be set while evaluation runs between incremental steps.
+    // (Reaching the same pairing again just queues its two cells again, as
+    // pairings are immutable once managed and can't refer to themselves.)
+    //
     // Caution note: We are writing this bit through the uint_fast32_t `bits`
     // of a REBVAL* header pointer, but we visit the series pool with a
     // REBSER*.  It would be unsafe to read it back via the `bits` field and
@@ -146,7 +231,10 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
     // try to work with this flag.  (Perhaps all MARKED access should go
     // through a byte-oriented API, as with IS_END()?)
     //
-    paired->header.bits |= NODE_FLAG_MARKED;
+    if (GC_Marking)
+        Note_Reached_Pairing(paired);  // see Mark_Reached_Pairings()
+    else
+        paired->header.bits |= NODE_FLAG_MARKED;
 
   #if !defined(NDEBUG)
     in_mark = was_in_mark;
@@ -171,8 +259,11 @@ static void Queue_Mark_Node_Deep(void *p)
 
     if (*bp & NODE_BYTEMASK_0x01_CELL) {  // e.g. a pairing
         REBVAL *v = VAL(p);
-        if (GET_CELL_FLAG(v, MANAGED))
+        if (GET_CELL_FLAG(v, MANAGED)) {
             Queue_Mark_Pairing_Deep(v);
+            if (GC_Minor)
+                Note_Minor_Mark(NOD(v));  // not swept, but must be unmarked
+        }
         else {
             // !!! It's a frame?  API handle?  Skip frame case (keysource)
             // for now, but revisit as technique matures.
@@ -181,6 +272,23 @@ static void Queue_Mark_Node_Deep(void *p)
     }
 
     REBSER *s = SER(p);
+    if (GC_Minor and GET_SERIES_INFO(s, SCANNED))
+        return;  // old, see Mark_Remembered_Series() for how writes are found
+
+    // An incremental recycle doesn't set NODE_FLAG_MARKED on series, since
+    // evaluation runs between its steps (and Expand_Series() asserts the bit
+    // is clear, for instance).  It colors them with info bits instead.  Once
+    // a series is SERIES_INFO_SCANNED its LINK(), MISC() and cells have been
+    // queued.  An array that is SERIES_INFO_REMEMBERED but not scanned is
+    // in the mark stack waiting for that, see Propagate_One_GC_Mark().
+    //
+    if (
+        GC_Marking
+        and (s->info.bits & (SERIES_INFO_SCANNED | SERIES_INFO_REMEMBERED))
+    ){
+        return;
+    }
+
     if (GET_SERIES_INFO(s, INACCESSIBLE)) {
         //
         // !!! All inaccessible nodes should be collapsed and canonized into
@@ -193,7 +301,13 @@ static void Queue_Mark_Node_Deep(void *p)
             SERIES_FLAG_LINK_NODE_NEEDS_MARK
                 | SERIES_FLAG_MISC_NODE_NEEDS_MARK
         );
-        s->header.bits |= NODE_FLAG_MARKED;
+        if (GC_Marking)
+            SET_SERIES_INFO(s, SCANNED);
+        else {
+            s->header.bits |= NODE_FLAG_MARKED;
+            if (GC_Minor)
+                Note_Minor_Mark(NOD(s));
+        }
         return;
     }
 
@@ -207,7 +321,19 @@ static void Queue_Mark_Node_Deep(void *p)
     }
   #endif
 
-    s->header.bits |= NODE_FLAG_MARKED; // may be already set
+    if (GC_Marking) {
+        if (IS_SER_ARRAY(s)) {  // LINK() and MISC() are queued when popped
+            SET_SERIES_INFO(s, REMEMBERED);
+            Push_Mark_Stack(ARR(s));
+            return;
+        }
+        SET_SERIES_INFO(s, SCANNED);
+    }
+    else {
+        s->header.bits |= NODE_FLAG_MARKED; // may be already set
+        if (GC_Minor)
+            Note_Minor_Mark(NOD(s));
+    }
 
     if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
         Queue_Mark_Node_Deep(LINK(s).custom.node);
@@ -215,24 +341,8 @@ static void Queue_Mark_Node_Deep(void *p)
     if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
         Queue_Mark_Node_Deep(MISC(s).custom.node);
 
-    if (IS_SER_ARRAY(s)) {
-        //
-        // Submits the array into the deferred stack to be processed later
-        // with Propagate_All_GC_Marks().  If it were not queued and just used
-        // recursion (as R3-Alpha did) then deeply nested arrays could
-        // overflow the C stack.
-        //
-        // !!! Could the amount of C stack space available be used for some
-        // amount of recursion, and only queue if running up against a limit?
-        //
-        // !!! Should this use a "bumping a NULL at the end" technique to
-        // grow, like the data stack?
-        //
-        if (SER_FULL(GC_Mark_Stack))
-            Extend_Series(GC_Mark_Stack, 8);
-        *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = ARR(s);
-        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) + 1);  // !term
-    }
+    if (IS_SER_ARRAY(s))
+        Push_Mark_Stack(ARR(s));
 }
 
 
@@ -281,63 +391,129 @@ static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v)
 
 
 //
-//  Propagate_All_GC_Marks: C
+//  Queue_Mark_Series_Contents: C
+//
+// Queue what a series refers to, regardless of whether the series itself is
+// marked.  (Marking stops at old series in a minor recycle, so this is how
+// the ones that were written to since the last recycle are looked into.  An
+// incremental recycle uses it the same way for series written after a step
+// scanned them, as well as to scan arrays it takes off the mark stack.)
+//
+static void Queue_Mark_Series_Contents(REBSER *s)
+{
+    if (GET_SERIES_INFO(s, INACCESSIBLE))
+        return;
+
+    if (GET_SERIES_FLAG(s, LINK_NODE_NEEDS_MARK) and LINK(s).custom.node)
+        Queue_Mark_Node_Deep(LINK(s).custom.node);
+
+    if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and MISC(s).custom.node)
+        Queue_Mark_Node_Deep(MISC(s).custom.node);
+
+    if (IS_SER_ARRAY(s)) {
+        RELVAL *item = ARR_HEAD(ARR(s));
+        for (; NOT_END(item); ++item)
+            Queue_Mark_Opt_Value_Deep(item);
+    }
+}
+
+
+//
+//  Propagate_One_GC_Mark: C
 //
 // The Mark Stack is a series containing series pointers.  They have already
 // had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
 // times, but the items they can reach are not necessarily marked yet.
 //
-// Processing continues until all reachable items from the mark stack are
-// known to be marked.
+// This takes one array off the stack and queues everything its cells refer
+// to (which may push more arrays).
 //
-static void Propagate_All_GC_Marks(void)
+static void Propagate_One_GC_Mark(void)
 {
     assert(not in_mark);
+    assert(SER_USED(GC_Mark_Stack) != 0);
 
-    while (SER_USED(GC_Mark_Stack) != 0) {
-        SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);  // safe
+    SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);  // safe
 
-        // Data pointer may change in response to an expansion during
-        // Mark_Array_Deep_Core(), so must be refreshed on each loop.
-        //
-        REBARR *a = *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack));
+    // Data pointer may change in response to an expansion during
+    // Mark_Array_Deep_Core(), so must be refreshed on each loop.
+    //
+    REBARR *a = *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack));
 
-        // Termination is not required in the release build (the length is
-        // enough to know where it ends).  But overwrite with trash in debug.
-        //
-        TRASH_POINTER_IF_DEBUG(
-            *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack))
-        );
+    // Termination is not required in the release build (the length is
+    // enough to know where it ends).  But overwrite with trash in debug.
+    //
+    TRASH_POINTER_IF_DEBUG(
+        *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack))
+    );
+
+    // An incremental recycle colors the array as scanned before it queues
+    // the contents, so that if evaluation between steps writes to it after
+    // this then Remember_Series() will list it to be scanned again.  (The
+    // array may also have decayed since it was queued, e.g. the varlist of
+    // a frame that finished, which Queue_Mark_Series_Contents() checks.)
+    //
+    if (GC_Marking) {
+        assert(GET_SERIES_INFO(a, REMEMBERED));
+        CLEAR_SERIES_INFO(a, REMEMBERED);
+        SET_SERIES_INFO(a, SCANNED);
+        Queue_Mark_Series_Contents(SER(a));
 
-        // We should have marked this series at queueing time to keep it from
-        // being doubly added before the queue had a chance to be processed
-         //
-        assert(SER(a)->header.bits & NODE_FLAG_MARKED);
+      #if !defined(NDEBUG)
+        if (NOT_SERIES_INFO(a, INACCESSIBLE))
+            Assert_Array_Marked_Correctly(a);
+      #endif
+        return;
+    }
 
-        RELVAL *v = ARR_HEAD(a);
-        for (; NOT_END(v); ++v) {
-            Queue_Mark_Opt_Value_Deep(v);
+    // We should have marked this series at queueing time to keep it from
+    // being doubly added before the queue had a chance to be processed
+     //
+    assert(SER(a)->header.bits & NODE_FLAG_MARKED);
 
-          #if !defined(NDEBUG)
-            //
-            // Nulls are illegal in most arrays, but context varlists use
-            // "nulled cells" to denote that the variable is not set.  Also
-            // reified C va_lists as Eval_Core() sources can have them.
-            //
-            if (
-                KIND_BYTE_UNCHECKED(v) == REB_NULLED
-                and NOT_ARRAY_FLAG(a, IS_VARLIST)
-                and NOT_ARRAY_FLAG(a, NULLEDS_LEGAL)
-            ){
-                panic(a);
-            }
-          #endif
-        }
+    RELVAL *v = ARR_HEAD(a);
+    for (; NOT_END(v); ++v) {
+        Queue_Mark_Opt_Value_Deep(v);
 
       #if !defined(NDEBUG)
-        Assert_Array_Marked_Correctly(a);
+        //
+        // Nulls are illegal in most arrays, but context varlists use
+        // "nulled cells" to denote that the variable is not set.  Also
+        // reified C va_lists as Eval_Core() sources can have them.
+        //
+        if (
+            KIND_BYTE_UNCHECKED(v) == REB_NULLED
+            and NOT_ARRAY_FLAG(a, IS_VARLIST)
+            and NOT_ARRAY_FLAG(a, NULLEDS_LEGAL)
+        ){
+            panic(a);
+        }
       #endif
     }
+
+  #if !defined(NDEBUG)
+    Assert_Array_Marked_Correctly(a);
+  #endif
+}
+
+
+//
+//  Propagate_All_GC_Marks: C
+//
+// Processing continues until all reachable items from the mark stack are
+// known to be marked.
+//
+// During the steps of an incremental recycle this does nothing, and the
+// queued arrays are left for Step_Incremental_Recycle() to process a few at
+// a time.  (Its final pause propagates them all, like any other recycle.)
+//
+static void Propagate_All_GC_Marks(void)
+{
+    if (GC_Marking and not GC_Finishing)
+        return;
+
+    while (SER_USED(GC_Mark_Stack) != 0)
+        Propagate_One_GC_Mark();
 }
 
 
@@ -456,7 +632,12 @@ static void Reify_Any_C_Valist_Frames(void)
     // be necessary for an incremental garbage collector), but for now the
     // feature is not supported.
     //
-    ASSERT_NO_GC_MARKS_PENDING();
+    // (The final pause of an incremental recycle may still have series
+    // queued.  Arrays made here are reached from the frames, which it marks
+    // as roots, the same as arrays made by evaluation between its steps.)
+    //
+    if (not GC_Marking)
+        ASSERT_NO_GC_MARKS_PENDING();
 
     REBFRM *f = FS_TOP;
     for (; f != FS_BOTTOM; f = f->prior) {
@@ -491,7 +672,7 @@ static void Mark_Root_Series(void)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER *, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = seg->units; n > 0; --n, ++s) {
             //
             // !!! A smarter switch statement here could do this more
             // optimally...see the sweep code for an example.
@@ -531,8 +712,11 @@ static void Mark_Root_Series(void)
                     GC_Kill_Series(s);
                     continue;
                 }
-                else // note that Mark_Frame_Stack_Deep() will mark the owner
+                else {  // note Mark_Frame_Stack_Deep() will mark the owner
                     s->header.bits |= NODE_FLAG_MARKED;
+                    if (GC_Minor)
+                        Note_Minor_Mark(NOD(s));  // not swept by a minor
+                }
 
                 // Note: Eval_Core() might target API cells, uses END
                 //
@@ -595,6 +779,147 @@ static void Mark_Root_Series(void)
 }
 
 
+//
+//  Queue_Mark_Root_Series: C
+//
+// Roots are often written without going through Remember_Series(), e.g. the
+// arguments in the varlist of a running frame.  So a minor recycle looks
+// into old root series each time, instead of stopping at them.  The final
+// pause of an incremental recycle does the same for roots a step scanned.
+//
+static void Queue_Mark_Root_Series(REBSER *s)
+{
+    if ((GC_Minor or GC_Marking) and GET_SERIES_INFO(s, SCANNED))
+        Queue_Mark_Series_Contents(s);
+    else
+        Queue_Mark_Node_Deep(s);
+}
+
+
+//
+//  Mark_Remembered_Series: C
+//
+// A minor recycle doesn't mark through series that survived a prior recycle,
+// so it has to find out which of those "old" series were changed to refer to
+// "young" ones since then.  That's what the Remember_Series() write barrier
+// is for: the first time an old series is written to, it gets added to the
+// GC_Remembered list.  A minor recycle looks into just those (shallowly, as
+// marking stops at anything old).
+//
+// An incremental recycle lists the series its steps scanned the same way, as
+// evaluation between the steps may write to them.  The steps rescan them as
+// they go.  (The final pause rescans all scanned series regardless, since not
+// every write is barriered, see Remark_Scanned_Series().)
+//
+// Any other recycle just forgets them, as a full recycle marks everything.
+// That's done after the sweep, as a series may be remembered while freeing
+// (e.g. by a HANDLE! cleaner).  So entries may be for nodes that have since
+// been freed or reused, and only those still with the bit are looked at.
+//
+static void Mark_Remembered_Series(void)
+{
+    REBSER **sp = SER_HEAD(REBSER*, GC_Remembered);
+    REBCNT n = SER_USED(GC_Remembered);
+    for (; n > 0; --n, ++sp) {
+        REBYTE *bp = cast(REBYTE*, *sp);
+        if (*bp == FREED_SERIES_BYTE or (*bp & NODE_BYTEMASK_0x01_CELL))
+            continue;
+
+        REBSER *s = *sp;
+        if (NOT_SERIES_INFO(s, REMEMBERED))
+            continue;  // node reused, or the same series was listed twice
+        CLEAR_SERIES_INFO(s, REMEMBERED);
+
+        if (GC_Minor or GC_Marking) {
+            Queue_Mark_Series_Contents(s);
+            Propagate_All_GC_Marks();
+        }
+    }
+
+    SET_SERIES_USED(GC_Remembered, 0);
+}
+
+
+//
+//  Remark_Scanned_Series: C
+//
+// The final pause of an incremental recycle rescans every series its steps
+// scanned, shallowly.  The Remember_Series() write barrier would list the
+// ones evaluation wrote to since then...but not all code that writes cells
+// goes through it yet.  (See Startup_GC())  So the pause can't trust it, and
+// this "remark" is what makes it sound.  It's about as long as a minor
+// recycle's pause, while the deep propagation was still done in steps.
+//
+static void Remark_Scanned_Series(void)
+{
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n = seg->units;
+        for (; n > 0; --n, ++s) {
+            REBYTE b = FIRST_BYTE(s->header);
+            if (b == FREED_SERIES_BYTE or (b & NODE_BYTEMASK_0x01_CELL))
+                continue;
+            if (NOT_SERIES_INFO(s, SCANNED))
+                continue;  // not reached (yet), or queued in the mark stack
+
+            CLEAR_SERIES_INFO(s, REMEMBERED);  // GC_Remembered is moot now
+            Queue_Mark_Series_Contents(s);
+        }
+
+        Propagate_All_GC_Marks();  // GC_Finishing, so it isn't left queued
+    }
+}
+
+
+//
+//  Mark_Reached_Pairings: C
+//
+// The pairings an incremental recycle reached are marked at the end of its
+// final pause, when no evaluation can see the bit.
+//
+static void Mark_Reached_Pairings(void)
+{
+    REBVAL **pp = SER_HEAD(REBVAL*, GC_Reached_Pairings);
+    REBCNT n = SER_USED(GC_Reached_Pairings);
+    for (; n > 0; --n, ++pp)
+        (*pp)->header.bits |= NODE_FLAG_MARKED;
+
+    SET_SERIES_USED(GC_Reached_Pairings, 0);
+}
+
+
+//
+//  Clear_Scanned_Series: C
+//
+// Take SERIES_INFO_SCANNED and SERIES_INFO_REMEMBERED off of every series.
+// An incremental recycle needs them clear when it starts, since it uses them
+// to color what its steps reach.  And when one gets interrupted by a recycle
+// that wants to start from scratch (shutdown, or a sweeplist) the colors it
+// gave out are taken back.
+//
+// This has to walk every node, so Start_Incremental_Recycle() only does it
+// if generational recycles left the bits behind (see GC_Any_Scanned).
+//
+static void Clear_Scanned_Series(void)
+{
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n = seg->units;
+        for (; n > 0; --n, ++s) {
+            REBYTE b = FIRST_BYTE(s->header);
+            if (b == FREED_SERIES_BYTE or (b & NODE_BYTEMASK_0x01_CELL))
+                continue;
+            s->info.bits &= ~(SERIES_INFO_SCANNED | SERIES_INFO_REMEMBERED);
+        }
+    }
+
+    SET_SERIES_USED(GC_Remembered, 0);
+    GC_Any_Scanned = false;
+}
+
+
 //
 //  Mark_Data_Stack: C
 //
@@ -634,8 +959,12 @@ static void Mark_Symbol_Series(void)
     REBSTR **canon = SER_HEAD(REBSTR*, PG_Symbol_Canons);
     assert(IS_POINTER_TRASH_DEBUG(*canon)); // SYM_0 for all non-builtin words
     ++canon;
-    for (; *canon != nullptr; ++canon)
-        SER(*canon)->header.bits |= NODE_FLAG_MARKED;
+    for (; *canon != nullptr; ++canon) {
+        if (GC_Marking)
+            SET_SERIES_INFO(*canon, SCANNED);  // see Queue_Mark_Node_Deep()
+        else
+            SER(*canon)->header.bits |= NODE_FLAG_MARKED;
+    }
 
     ASSERT_NO_GC_MARKS_PENDING(); // doesn't ues any queueing
 }
@@ -660,6 +989,28 @@ static void Mark_Natives(void)
 }
 
 
+//
+//  Mark_Scan_Cache: C
+//
+// The arrays which UTF-8 fragments passed to the variadic API scanned to are
+// kept for reuse, along with the contexts their words were bound in.  See
+// Scan_Va_To_Stack().
+//
+static void Mark_Scan_Cache(void)
+{
+    REBCNT n;
+    for (n = 0; n < SCAN_CACHE_SIZE; ++n) {
+        struct Reb_Scan_Cache *entry = &TG_Scan_Cache[n];
+        if (not entry->array)
+            continue;
+        Queue_Mark_Node_Deep(entry->array);
+        Queue_Mark_Node_Deep(CTX_VARLIST(entry->context));
+    }
+
+    Propagate_All_GC_Marks();
+}
+
+
 //
 //  Mark_Guarded_Nodes: C
 //
@@ -680,7 +1031,7 @@ static void Mark_Guarded_Nodes(void)
             Queue_Mark_Opt_End_Cell_Deep(cast(REBVAL*, node));
         }
         else  // a series
-            Queue_Mark_Node_Deep(node);
+            Queue_Mark_Root_Series(SER(node));
 
         Propagate_All_GC_Marks();
     }
@@ -788,7 +1139,7 @@ static void Mark_Frame_Stack_Deep(void)
             // partial parameter traversal.
             //
             assert(IS_END(f->param)); // done walking
-            Queue_Mark_Node_Deep(CTX(f->varlist));
+            Queue_Mark_Root_Series(SER(f->varlist));
             goto propagate_and_continue;
         }
 
@@ -858,20 +1209,24 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Find_Sweep_Garbage: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Scan the segments of a sweep job, clearing the marks on live nodes and
+// setting a bit in the job's `dead` bitmap for each node that is garbage.
+// Nothing is freed here, and only the live nodes themselves are written...so
+// jobs for different segments can run on worker threads at the same time.
+// (Freeing can't, as it runs handle cleaners and updates the pools and the
+// symbol table, see Free_Sweep_Garbage().)
 //
-static REBCNT Sweep_Series(void)
+static void Find_Sweep_Garbage(struct Reb_Sweep_Job *job)
 {
-    REBCNT count = 0;
-
-    REBSEG *seg = Mem_Pools[SER_POOL].segs;
-    for (; seg != nullptr; seg = seg->next) {
-        REBCNT n = Mem_Pools[SER_POOL].units;
+    REBSEG *seg = job->seg;
+    uintptr_t *dead = job->dead;
+    REBCNT i;
+    for (i = 0; i < job->num_segs; ++i, seg = seg->next) {
+        const REBCNT units = seg->units;
+        const REBCNT words = SWEEP_WORDS_PER_SEG(units);
+        memset(dead, 0, words * sizeof(uintptr_t));
 
         // We use a generic byte pointer (unsigned char*) to dodge the rules
         // for strict aliasing, as the pool may contain pairs of REBVAL from
@@ -880,11 +1235,12 @@ static REBCNT Sweep_Series(void)
         //
         // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
         // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
+        // nodes only--see loop in Sweep_Series() for the pairing pool.
 
         REBYTE *bp = cast(REBYTE*, seg + 1);
 
-        for (; n > 0; --n, bp += sizeof(REBSER)) {
+        REBCNT n;
+        for (n = 0; n < units; ++n, bp += sizeof(REBSER)) {
             switch (*bp >> 4) {
               case 0:
               case 1:  // 0x1
@@ -897,9 +1253,12 @@ static REBCNT Sweep_Series(void)
                 //
                 // NODE_FLAG_NODE (0x8) is clear.  This signature is
                 // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
+                // values in the first byte).  Can't panic() from a worker,
+                // so this is reported after the jobs are finished.
                 //
-                panic (bp);
+                if (not job->corrupt)
+                    job->corrupt = bp;
+                break;
 
             // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
@@ -920,31 +1279,46 @@ static REBCNT Sweep_Series(void)
                 // 0x8 + 0x1: marked but not managed, this can't happen,
                 // because the marking itself asserts nodes are managed.
                 //
-                panic (bp);
+                if (not job->corrupt)
+                    job->corrupt = bp;
+                break;
 
               case 10:
                 // 0x8 + 0x2: managed but didn't get marked, should be GC'd
                 //
+                // ...unless an incremental recycle reached the series, as
+                // those are colored with SERIES_INFO_SCANNED instead.
+                //
                 // !!! It would be nice if we could have NODE_FLAG_CELL here
                 // as part of the switch, but see its definition for why it
                 // is at position 8 from left and not an earlier bit.
                 //
-                if (*bp & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
-                    Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
-                }
-                else {
-                    REBSER *s = cast(REBSER*, bp);
-                    GC_Kill_Series(s);
+                if (
+                    job->scanned_live
+                    and not (*bp & NODE_BYTEMASK_0x01_CELL)
+                    and (cast(REBSER*, bp)->info.bits & SERIES_INFO_SCANNED)
+                ){
+                    if (not job->tenure)
+                        cast(REBSER*, bp)->info.bits &= ~SERIES_INFO_SCANNED;
+                    break;
                 }
-                ++count;
+                dead[n / SWEEP_BITS_PER_WORD]
+                    |= cast(uintptr_t, 1) << (n % SWEEP_BITS_PER_WORD);
                 break;
 
               case 11:
                 // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
+                // Don't GC it, just clear the mark.  Generational mode makes
+                // the series "old" (pairings and API handles aren't swept by
+                // minor recycles, so they don't have an age).
                 //
                 *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+                if (*bp & (NODE_BYTEMASK_0x01_CELL | NODE_BYTEMASK_0x04_ROOT))
+                    break;
+                if (job->tenure)
+                    cast(REBSER*, bp)->info.bits |= SERIES_INFO_SCANNED;
+                else
+                    cast(REBSER*, bp)->info.bits &= ~SERIES_INFO_SCANNED;
                 break;
 
             // v-- Everything below this line has the two leftmost bits set
@@ -960,63 +1334,524 @@ static REBCNT Sweep_Series(void)
 
               case 13:
               case 14:
-              case 15:
-                panic (bp);  // 0x8 + 0x4 + ... reserved for UTF-8
+              case 15:  // 0x8 + 0x4 + ... reserved for UTF-8
+                if (not job->corrupt)
+                    job->corrupt = bp;
+                break;
             }
         }
+
+        dead += words;
     }
+}
 
-    // For efficiency of memory use, REBSER is nominally defined as
-    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
-    // that might make the cells a size greater than REBSER size require
-    // doing pairings in a different pool.
-    //
-  #ifdef UNUSUAL_REBVAL_SIZE
-    for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
-        REBVAL *v = cast(REBVAL*, seg + 1);
-        REBCNT n = Mem_Pools[PAR_POOL].units;
-        for (; n > 0; --n, v += 2) {
-            if (v->header.bits & NODE_FLAG_FREE) {
-                assert(FIRST_BYTE(v->header) == FREED_SERIES_BYTE);
-                continue;
-            }
 
-            assert(v->header.bits & NODE_FLAG_CELL);
+//
+//  Free_Sweep_Garbage: C
+//
+// Free the nodes that Find_Sweep_Garbage() put in a job's `dead` bitmap.
+// This has to be done on the main thread.
+//
+static REBCNT Free_Sweep_Garbage(struct Reb_Sweep_Job *job)
+{
+    if (job->corrupt)
+        panic (job->corrupt);
 
-            if (v->header.bits & NODE_FLAG_MANAGED) {
-                assert(not (v->header.bits & NODE_FLAG_ROOT));
-                if (v->header.bits & NODE_FLAG_MARKED)
-                    v->header.bits &= ~NODE_FLAG_MARKED;
-                else {
-                    Free_Node(PAR_POOL, NOD(v));  // Free_Pairing is for manuals
-                    ++count;
+    REBCNT count = 0;
+
+    REBSEG *seg = job->seg;
+    uintptr_t *dead = job->dead;
+    REBCNT i;
+    for (i = 0; i < job->num_segs; ++i, seg = seg->next) {
+        const REBCNT words = SWEEP_WORDS_PER_SEG(seg->units);
+        REBYTE *base = cast(REBYTE*, seg + 1);
+
+        REBCNT w;
+        for (w = 0; w < words; ++w, ++dead) {
+            uintptr_t bits = *dead;
+            REBCNT n = w * SWEEP_BITS_PER_WORD;
+            for (; bits != 0; bits >>= 1, ++n) {
+                if (not (bits & 1))
+                    continue;
+
+                REBYTE *bp = base + (n * sizeof(REBSER));
+
+                // Freeing a series can run a HANDLE! cleaner, so recheck in
+                // case that did something unusual to this node.
+                //
+                if (*bp >> 4 != 10)
+                    continue;
+
+                if (*bp & NODE_BYTEMASK_0x01_CELL) {
+                    assert(not (*bp & NODE_BYTEMASK_0x04_ROOT));
+                    Free_Node(SER_POOL, NOD(bp));  // Free_Pairing for manuals
                 }
+                else
+                    GC_Kill_Series(cast(REBSER*, bp));
+                ++count;
             }
         }
     }
-  #endif
 
     return count;
 }
 
 
-#if !defined(NDEBUG)
+#if defined(USE_WORKER_THREADS)
 
 //
-//  Fill_Sweeplist: C
+//  Decay_Sweep_Garbage: C
 //
-REBCNT Fill_Sweeplist(REBSER *sweeplist)
+// First half of freeing what Find_Sweep_Garbage() found, for a parallel
+// sweep.  This releases the data of the dead series (which may run HANDLE!
+// cleaners, update the symbol table, etc.) so it has to be on this thread.
+// The nodes themselves are left for Release_Sweep_Garbage().
+//
+static void Decay_Sweep_Garbage(struct Reb_Sweep_Job *job)
 {
-    assert(SER_WIDE(sweeplist) == sizeof(REBNOD*));
-    assert(SER_USED(sweeplist) == 0);
+    if (job->corrupt)
+        panic (job->corrupt);
+
+    REBSEG *seg = job->seg;
+    uintptr_t *dead = job->dead;
+    REBCNT i;
+    for (i = 0; i < job->num_segs; ++i, seg = seg->next) {
+        const REBCNT words = SWEEP_WORDS_PER_SEG(seg->units);
+        REBYTE *base = cast(REBYTE*, seg + 1);
+
+        REBCNT w;
+        for (w = 0; w < words; ++w, ++dead) {
+            uintptr_t bits = *dead;
+            REBCNT n = w * SWEEP_BITS_PER_WORD;
+            for (; bits != 0; bits >>= 1, ++n) {
+                if (not (bits & 1))
+                    continue;
 
-    REBCNT count = 0;
+                REBYTE *bp = base + (n * sizeof(REBSER));
+                if (*bp >> 4 != 10 or (*bp & NODE_BYTEMASK_0x01_CELL))
+                    continue;  // pairing, or a cleaner did something unusual
+
+                REBSER *s = cast(REBSER*, bp);
+                if (NOT_SERIES_INFO(s, INACCESSIBLE))
+                    Decay_Series(s);
+
+              #if !defined(NDEBUG)
+                PG_Reb_Stats->Series_Freed++;
+              #endif
+            }
+        }
+    }
+}
+
+
+//
+//  Release_Sweep_Garbage: C
+//
+// Second half of freeing what Find_Sweep_Garbage() found, which can run on
+// a worker thread.  The dead nodes are made free and linked into a list of
+// the job's own, which is spliced into the pool afterward.  (Nodes a cleaner
+// freed during Decay_Sweep_Garbage() are already free, and skipped.)
+//
+static void Release_Sweep_Garbage(struct Reb_Sweep_Job *job)
+{
+    job->freed = nullptr;
+    job->freed_last = nullptr;
+    job->num_freed = 0;
+
+    REBSEG *seg = job->seg;
+    uintptr_t *dead = job->dead;
+    REBCNT i;
+    for (i = 0; i < job->num_segs; ++i, seg = seg->next) {
+        const REBCNT words = SWEEP_WORDS_PER_SEG(seg->units);
+        REBYTE *base = cast(REBYTE*, seg + 1);
+
+        REBCNT w;
+        for (w = 0; w < words; ++w, ++dead) {
+            uintptr_t bits = *dead;
+            REBCNT n = w * SWEEP_BITS_PER_WORD;
+            for (; bits != 0; bits >>= 1, ++n) {
+                if (not (bits & 1))
+                    continue;
+
+                REBYTE *bp = base + (n * sizeof(REBSER));
+                if (*bp >> 4 != 10)
+                    continue;
+
+              #if !defined(NDEBUG)
+                if (not (*bp & NODE_BYTEMASK_0x01_CELL)) {  // as Kill does
+                    REBSER *s = cast(REBSER*, bp);
+                    s->info.bits = FLAG_WIDE_BYTE_OR_0(77);
+                    FREETRASH_POINTER_IF_DEBUG(s->misc_private.trash);
+
+                  #if defined(DEBUG_COUNT_TICKS)
+                    s->tick = TG_Tick;  // tick on which series was freed
+                  #endif
+                }
+              #endif
+
+                REBNOD *node = cast(REBNOD*, bp);  // NOD() checks for free
+                mutable_FIRST_BYTE(node->header) = FREED_SERIES_BYTE;
+                node->next_if_free = job->freed;
+                job->freed = node;
+                if (not job->freed_last)
+                    job->freed_last = node;
+                ++job->num_freed;
+            }
+        }
+    }
+}
+
+
+// Sweep workers are started the first time a sweep is big enough to split
+// up, and then wait for each phase of a parallel sweep (finding garbage, and
+// releasing it) instead of being made and joined on every recycle.  Worker
+// `n` does job `n` of the phase, and this thread does job 0 (and any jobs
+// there are no workers for).
+//
+enum Reb_Sweep_Phase {
+    SWEEP_PHASE_FIND,
+    SWEEP_PHASE_RELEASE,
+    SWEEP_PHASE_QUIT
+};
+
+static pthread_mutex_t GC_Sweep_Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t GC_Sweep_Wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t GC_Sweep_Done = PTHREAD_COND_INITIALIZER;
+
+static pthread_t GC_Sweep_Workers[MEM_SWEEP_MAX_THREADS];
+static REBCNT GC_Sweep_Num_Workers;  // workers are 1..GC_Sweep_Num_Workers
+static bool GC_Sweep_Workers_Started;
+
+static REBCNT GC_Sweep_Round;  // bumped to wake the workers for a phase
+static REBCNT GC_Sweep_Busy;  // workers yet to finish the phase
+static enum Reb_Sweep_Phase GC_Sweep_Phase;
+static struct Reb_Sweep_Job *GC_Sweep_Jobs;
+static REBCNT GC_Sweep_Num_Jobs;
+
+static void Do_Sweep_Phase(
+    enum Reb_Sweep_Phase phase,
+    struct Reb_Sweep_Job *job
+){
+    if (phase == SWEEP_PHASE_FIND)
+        Find_Sweep_Garbage(job);
+    else
+        Release_Sweep_Garbage(job);
+}
+
+static void *Sweep_Worker(void *p)
+{
+    REBCNT id = cast(REBCNT, cast(uintptr_t, p));
+    REBCNT round = 0;
+
+    pthread_mutex_lock(&GC_Sweep_Mutex);
+    while (true) {
+        while (GC_Sweep_Round == round)
+            pthread_cond_wait(&GC_Sweep_Wake, &GC_Sweep_Mutex);
+        round = GC_Sweep_Round;
+
+        enum Reb_Sweep_Phase phase = GC_Sweep_Phase;
+        if (phase == SWEEP_PHASE_QUIT)
+            break;
+
+        struct Reb_Sweep_Job *job
+            = (id < GC_Sweep_Num_Jobs) ? &GC_Sweep_Jobs[id] : nullptr;
+
+        pthread_mutex_unlock(&GC_Sweep_Mutex);
+        if (job)
+            Do_Sweep_Phase(phase, job);
+        pthread_mutex_lock(&GC_Sweep_Mutex);
+
+        if (--GC_Sweep_Busy == 0)
+            pthread_cond_signal(&GC_Sweep_Done);
+    }
+    pthread_mutex_unlock(&GC_Sweep_Mutex);
+
+    return nullptr;
+}
+
+static void Start_Sweep_Workers(void)
+{
+    GC_Sweep_Workers_Started = true;
+    GC_Sweep_Num_Workers = 0;
+
+    REBCNT n;
+    for (n = 1; n < GC_Sweep_Threads; ++n) {
+        if (0 != pthread_create(
+            &GC_Sweep_Workers[n],
+            nullptr,
+            &Sweep_Worker,
+            cast(void*, cast(uintptr_t, n))
+        )){
+            break;  // jobs without a worker are just done on this thread
+        }
+        GC_Sweep_Num_Workers = n;
+    }
+}
+
+static void Run_Sweep_Phase(
+    enum Reb_Sweep_Phase phase,
+    struct Reb_Sweep_Job *jobs,
+    REBCNT num_jobs
+){
+    pthread_mutex_lock(&GC_Sweep_Mutex);
+    GC_Sweep_Jobs = jobs;
+    GC_Sweep_Num_Jobs = num_jobs;
+    GC_Sweep_Phase = phase;
+    GC_Sweep_Busy = GC_Sweep_Num_Workers;
+    ++GC_Sweep_Round;
+    pthread_cond_broadcast(&GC_Sweep_Wake);
+    pthread_mutex_unlock(&GC_Sweep_Mutex);
+
+    Do_Sweep_Phase(phase, &jobs[0]);
+
+    REBCNT i;
+    for (i = GC_Sweep_Num_Workers + 1; i < num_jobs; ++i)
+        Do_Sweep_Phase(phase, &jobs[i]);
+
+    pthread_mutex_lock(&GC_Sweep_Mutex);
+    while (GC_Sweep_Busy != 0)
+        pthread_cond_wait(&GC_Sweep_Done, &GC_Sweep_Mutex);
+    pthread_mutex_unlock(&GC_Sweep_Mutex);
+}
+
+static void Stop_Sweep_Workers(void)
+{
+    if (not GC_Sweep_Workers_Started)
+        return;
+
+    pthread_mutex_lock(&GC_Sweep_Mutex);
+    GC_Sweep_Phase = SWEEP_PHASE_QUIT;
+    ++GC_Sweep_Round;
+    pthread_cond_broadcast(&GC_Sweep_Wake);
+    pthread_mutex_unlock(&GC_Sweep_Mutex);
+
+    REBCNT n;
+    for (n = 1; n <= GC_Sweep_Num_Workers; ++n)
+        pthread_join(GC_Sweep_Workers[n], nullptr);
+
+    GC_Sweep_Workers_Started = false;
+}
+
+
+//
+//  Sweep_Series_Parallel: C
+//
+// Split the SER_POOL segments into runs, and have the sweep workers find the
+// garbage in each run.  The dead series are decayed on this thread, then
+// the workers release the nodes into lists of their own which are spliced
+// into the pool.  Returns false if there aren't enough segments to be worth
+// it (or no worker threads).
+//
+static bool Sweep_Series_Parallel(REBCNT *count)
+{
+    REBCNT num_segs = 0;
+    REBCNT words = 0;  // segments can differ in size, see Fill_Pool()
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next) {
+        ++num_segs;
+        words += SWEEP_WORDS_PER_SEG(seg->units);
+    }
+
+    REBCNT num_jobs = num_segs / MEM_SWEEP_MIN_SEGS;
+    if (num_jobs > GC_Sweep_Threads)
+        num_jobs = GC_Sweep_Threads;
+    if (num_jobs < 2)
+        return false;
+
+    if (not GC_Sweep_Workers_Started)
+        Start_Sweep_Workers();
+    if (GC_Sweep_Num_Workers == 0)
+        return false;
+
+    uintptr_t *bitmaps = ALLOC_N(uintptr_t, words);
+    if (not bitmaps)
+        return false;
+
+    struct Reb_Sweep_Job jobs[MEM_SWEEP_MAX_THREADS];
+
+    seg = Mem_Pools[SER_POOL].segs;
+    uintptr_t *dead = bitmaps;
+    REBCNT i;
+    for (i = 0; i < num_jobs; ++i) {
+        struct Reb_Sweep_Job *job = &jobs[i];
+        job->seg = seg;
+        job->tenure = GC_Generational;
+        job->scanned_live = GC_Marking;
+        job->num_segs = num_segs / num_jobs;
+        if (i < num_segs % num_jobs)
+            ++job->num_segs;
+        job->dead = dead;
+        job->corrupt = nullptr;
 
-    REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
-        REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = 0; n < job->num_segs; ++n, seg = seg->next)
+            dead += SWEEP_WORDS_PER_SEG(seg->units);
+    }
+    assert(seg == nullptr);
+
+    Run_Sweep_Phase(SWEEP_PHASE_FIND, jobs, num_jobs);
+
+    for (i = 0; i < num_jobs; ++i)
+        Decay_Sweep_Garbage(&jobs[i]);
+
+    Run_Sweep_Phase(SWEEP_PHASE_RELEASE, jobs, num_jobs);
+
+    for (i = 0; i < num_jobs; ++i) {
+        if (jobs[i].num_freed == 0)
+            continue;
+        Splice_Free_Nodes(
+            SER_POOL, jobs[i].freed, jobs[i].freed_last, jobs[i].num_freed
+        );
+        *count += jobs[i].num_freed;
+    }
+
+    if (GC_Ballast > 0)
+        CLR_SIGNAL(SIG_RECYCLE);  // as GC_Kill_Series() does
+
+    FREE_N(uintptr_t, words, bitmaps);
+    return true;
+}
+
+#endif
+
+
+//
+//  Sweep_Series: C
+//
+// Scans all series nodes (REBSER structs) in all segments that are part of
+// the SER_POOL.  If a series had its lifetime management delegated to the
+// garbage collector with Manage_Series(), then if it didn't get "marked" as
+// live during the marking phase then free it.
+//
+// Finding the garbage only involves the node headers, so on big heaps the
+// segments are split up among worker threads if the build supports them.
+// (They also release the dead nodes, once their data has been freed here.)
+// Otherwise each segment is scanned and then has its garbage freed in turn,
+// while it's still in the cache.
+//
+static REBCNT Sweep_Series(void)
+{
+    REBCNT count = 0;
+
+    REBSEG *seg;
+
+  #if defined(USE_WORKER_THREADS)
+    if (not Sweep_Series_Parallel(&count))
+  #endif
+    {
+        struct Reb_Sweep_Job job;
+        job.num_segs = 1;
+        job.tenure = GC_Generational;
+        job.scanned_live = GC_Marking;
+        job.dead = SER_HEAD(uintptr_t, GC_Sweep_Bits);
+        job.corrupt = nullptr;
+
+        for (seg = Mem_Pools[SER_POOL].segs; seg != nullptr; seg = seg->next) {
+            job.seg = seg;
+            Find_Sweep_Garbage(&job);
+            count += Free_Sweep_Garbage(&job);
+        }
+    }
+
+    // For efficiency of memory use, REBSER is nominally defined as
+    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
+    // that might make the cells a size greater than REBSER size require
+    // doing pairings in a different pool.
+    //
+  #ifdef UNUSUAL_REBVAL_SIZE
+    for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
+        REBVAL *v = cast(REBVAL*, seg + 1);
+        REBCNT n = seg->units;
+        for (; n > 0; --n, v += 2) {
+            if (v->header.bits & NODE_FLAG_FREE) {
+                assert(FIRST_BYTE(v->header) == FREED_SERIES_BYTE);
+                continue;
+            }
+
+            assert(v->header.bits & NODE_FLAG_CELL);
+
+            if (v->header.bits & NODE_FLAG_MANAGED) {
+                assert(not (v->header.bits & NODE_FLAG_ROOT));
+                if (v->header.bits & NODE_FLAG_MARKED)
+                    v->header.bits &= ~NODE_FLAG_MARKED;
+                else {
+                    Free_Node(PAR_POOL, NOD(v));  // Free_Pairing is for manuals
+                    ++count;
+                }
+            }
+        }
+    }
+  #endif
+
+    return count;
+}
+
+
+//
+//  Sweep_Nursery: C
+//
+// A minor recycle only considers series logged by Track_Young_Series() since
+// the last recycle.  Those which didn't get marked are freed.
+//
+// The log may contain stale entries: a series could have been freed (e.g. an
+// expired API handle), and the node reused for a manual series or a pairing.
+// Or the same node could be logged twice.  Hence the header is rechecked.
+//
+// Then the marks are taken off of everything the minor recycle marked, and
+// the series among them are promoted to the old generation.
+//
+static REBCNT Sweep_Nursery(void)
+{
+    REBCNT count = 0;
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Nursery);
+    REBCNT n = SER_USED(GC_Nursery);
+    for (; n > 0; --n, ++sp) {
+        REBYTE *bp = cast(REBYTE*, *sp);
+        if (*bp >> 4 != 10)  // 0x8 + 0x2: managed but didn't get marked
+            continue;
+
+        if (*bp & (NODE_BYTEMASK_0x01_CELL | NODE_BYTEMASK_0x04_ROOT))
+            continue;  // reused for a pairing or API handle, not swept here
+
+        GC_Kill_Series(cast(REBSER*, bp));
+        ++count;
+    }
+
+    SET_SERIES_USED(GC_Nursery, 0);
+
+    REBNOD **np = SER_HEAD(REBNOD*, GC_Minor_Marks);
+    n = SER_USED(GC_Minor_Marks);
+    for (; n > 0; --n, ++np) {
+        REBYTE *bp = cast(REBYTE*, *np);
+        assert(*bp & NODE_BYTEMASK_0x10_MARKED);
+        *bp &= ~NODE_BYTEMASK_0x10_MARKED;
+        if (not (*bp & (NODE_BYTEMASK_0x01_CELL | NODE_BYTEMASK_0x04_ROOT)))
+            SET_SERIES_INFO(cast(REBSER*, bp), SCANNED);
+    }
+
+    SET_SERIES_USED(GC_Minor_Marks, 0);
+    return count;
+}
+
+
+#if !defined(NDEBUG)
+
+//
+//  Fill_Sweeplist: C
+//
+REBCNT Fill_Sweeplist(REBSER *sweeplist)
+{
+    assert(SER_WIDE(sweeplist) == sizeof(REBNOD*));
+    assert(SER_USED(sweeplist) == 0);
+
+    REBCNT count = 0;
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+        REBSER *s = cast(REBSER*, seg + 1);
+        REBCNT n;
+        for (n = seg->units; n > 0; --n, ++s) {
             switch (FIRST_BYTE(s->header) >> 4) {
             case 9: // 0x8 + 0x1
                 ASSERT_SERIES_MANAGED(s);
@@ -1056,14 +1891,70 @@ REBCNT Fill_Sweeplist(REBSER *sweeplist)
 
 
 //
-//  Recycle_Core: C
+//  Update_Ballast: C
 //
-// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
-// to be a series whose width is sizeof(REBSER*), and it will be filled with
-// the list of series that *would* be recycled.
+// R3-Alpha recycled after a fixed amount of allocation (MEM_BALLAST, or what
+// RECYCLE/BALLAST set).  That's too often for programs with a lot of live
+// data, since each recycle has to mark all of it...and too seldom for those
+// with little, which then hold on to a lot of garbage.  So the ballast is a
+// percentage (GC_Growth) of the memory still in use after the recycle, with
+// the RECYCLE/BALLAST amount as the minimum.
 //
-REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
+// If most of what was allocated since the prior recycle survived this one,
+// then the program is building up data and the recycle was mostly wasted.
+// The ballast is doubled then, so recycling backs off faster than the live
+// memory grows.
+//
+// (The commented-out code this replaces came from Atronix, who had raised
+// the issue: https://github.com/zsx/r3/issues/32)
+//
+static void Update_Ballast(REBI64 allocated, REBI64 freed)
 {
+    if (allocated <= 0)
+        GC_Survival = 0;
+    else if (freed >= allocated)
+        GC_Survival = 0;
+    else if (freed <= 0)
+        GC_Survival = 100;
+    else
+        GC_Survival = cast(REBCNT, ((allocated - freed) * 100) / allocated);
+
+    REBU64 unused = 0;  // pool nodes that are free still count in PG_Mem_Usage
+    REBCNT n;
+    for (n = 0; n != SYSTEM_POOL; ++n) {
+        REBCNT free = Mem_Pools[n].free + TG_Magazines[n].count;
+        unused += cast(REBU64, free) * Mem_Pools[n].wide;
+    }
+    GC_Live_Bytes = PG_Mem_Usage > unused ? PG_Mem_Usage - unused : 0;
+
+    if (TG_Ballast == 0 or GC_Growth == 0)
+        return;  // RECYCLE/TORTURE, or fixed ballast
+
+    REBU64 target = (GC_Live_Bytes / 100) * GC_Growth;
+    if (GC_Survival >= MEM_SURVIVAL_HIGH)
+        target *= 2;
+
+    if (target < cast(REBU64, TG_Max_Ballast))
+        TG_Ballast = TG_Max_Ballast;
+    else if (target > INT32_MAX)
+        TG_Ballast = INT32_MAX;  // GC_Ballast is 32-bit
+    else
+        TG_Ballast = cast(REBI64, target);
+}
+
+
+//
+//  Recycle_Generation_Core: C
+//
+// Shared implementation of full and minor recycles.  A minor recycle is only
+// possible if the previous recycle was generational, so that its survivors
+// can be told apart as "old".  Otherwise it falls back to being a full one.
+//
+static REBCNT Recycle_Generation_Core(
+    bool shutdown,
+    bool minor,
+    REBSER *sweeplist
+){
     // Ordinarily, it should not be possible to spawn a recycle during a
     // recycle.  But when debug code is added into the recycling code, it
     // could cause a recursion.  Be tolerant of such recursions to make that
@@ -1095,16 +1986,49 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
         return 0;
     }
 
+    // If an incremental recycle is underway, this is its final pause.  The
+    // steps have colored series that were reachable when it started, and
+    // what's left is what evaluation since then could have changed: the
+    // roots, and the series the steps scanned (see Remark_Scanned_Series()).
+    // But shutdown and sweeplists want a from-scratch answer, so the colors
+    // are cleared.
+    //
+    bool remark = false;
+    if (GC_Marking) {
+        minor = false;
+        if (shutdown or sweeplist) {
+            SET_SERIES_USED(GC_Mark_Stack, 0);
+            SET_SERIES_USED(GC_Reached_Pairings, 0);
+            Clear_Scanned_Series();
+            GC_Marking = false;
+        }
+        else {
+            remark = true;
+            GC_Finishing = true;  // GC_Marking stays set until the sweep
+        }
+    }
+
+    if (shutdown or sweeplist or not GC_Generational or not GC_Old_Known)
+        minor = false;
+
+    // Allocations count down GC_Ballast from TG_Ballast, and freeing series
+    // data adds back to it.  So this tells how much was allocated since the
+    // last recycle, and (after the sweep) how much this recycle freed.
+    //
+    REBINT ballast = GC_Ballast;
+
   #if !defined(NDEBUG)
     GC_Recycling = true;
   #endif
 
-    ASSERT_NO_GC_MARKS_PENDING();
+    if (not remark)
+        ASSERT_NO_GC_MARKS_PENDING();
     Reify_Any_C_Valist_Frames();
 
   #if !defined(NDEBUG)
     PG_Reb_Stats->Recycle_Counter++;
-    PG_Reb_Stats->Recycle_Series = Mem_Pools[SER_POOL].free;
+    PG_Reb_Stats->Recycle_Series
+        = Mem_Pools[SER_POOL].free + TG_Magazines[SER_POOL].count;
     PG_Reb_Stats->Mark_Count = 0;
   #endif
 
@@ -1125,6 +2049,20 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
         GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_Series()
     }
 
+    // A minor recycle treats everything that survived the last recycle as
+    // live, but has to find the references old series have to young ones.
+    // Finishing an incremental recycle rescans everything its steps scanned,
+    // and marks whatever the steps didn't get to.
+    //
+    if (minor) {
+        GC_Minor = true;
+        Mark_Remembered_Series();
+    }
+    else if (remark) {
+        Propagate_All_GC_Marks();
+        Remark_Scanned_Series();
+    }
+
     // MARKING PHASE: the "root set" from which we determine the liveness
     // (or deadness) of a series.  If we are shutting down, we do not mark
     // several categories of series...but we do need to run the root marking.
@@ -1135,7 +2073,9 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
 
     if (not shutdown) {
         Mark_Natives();
-        Mark_Symbol_Series();
+        Mark_Scan_Cache();
+        if (not minor)
+            Mark_Symbol_Series();  // a full recycle made them all old
 
         Mark_Data_Stack();
 
@@ -1148,6 +2088,9 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
         Mark_Devices_Deep();
     }
 
+    if (remark)
+        Mark_Reached_Pairings();
+
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
@@ -1161,46 +2104,56 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if (minor)
+        count += Sweep_Nursery();
     else
         count += Sweep_Series();
 
+    // Anything logged in the nursery has now been freed, or it's old if the
+    // sweep was generational.  And a full recycle has seen everything that
+    // old series refer to, so it forgets which of them were written to.
+    //
+    GC_Marking = false;
+    GC_Finishing = false;
+    SET_SERIES_USED(GC_Nursery, 0);
+    if (not minor)
+        Mark_Remembered_Series();
+    GC_Old_Known = (
+        not shutdown and sweeplist == nullptr and GC_Generational
+    );
+    if (sweeplist == nullptr)
+        GC_Any_Scanned = GC_Generational;  // else the sweep cleared them all
+    GC_Minor = false;
+    if (minor)
+        ++GC_Minor_Count;
+    else
+        GC_Minor_Count = 0;
+
 #if !defined(NDEBUG)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
-        = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
+        = Mem_Pools[SER_POOL].free + TG_Magazines[SER_POOL].count
+            - PG_Reb_Stats->Recycle_Series;
     PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
     PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
 #endif
 
+    // A full sweep is when segments are most likely to have become free.
+    // (Shutdown_Pools() frees them all at shutdown.)
+    //
+    if (not minor and not shutdown and sweeplist == nullptr)
+        GC_Released += Release_Free_Segments(GC_Retain);
+
     // Do not adjust task variables or boot strings in shutdown when they
     // are being freed.
     //
     if (not shutdown) {
+        // Freeing only gives back data to GC_Ballast, not the node size
+        // that Alloc_Series_Node() took from it.
         //
-        // !!! This code was added by Atronix to deal with frequent garbage
-        // collection, but the logic is not correct.  The issue has been
-        // raised and is commented out pending a correct solution.
-        //
-        // https://github.com/zsx/r3/issues/32
-        //
-        /*if (GC_Ballast <= TG_Ballast / 2
-            && TG_Task_Ballast < INT32_MAX) {
-            //increasing ballast by half
-            TG_Ballast /= 2;
-            TG_Ballast *= 3;
-        } else if (GC_Ballast >= TG_Ballast * 2) {
-            //reduce ballast by half
-            TG_Ballast /= 2;
-        }
-
-        // avoid overflow
-        if (
-            TG_Ballast < 0
-            || TG_Ballast >= INT32_MAX
-        ) {
-            TG_Ballast = INT32_MAX;
-        }*/
-
+        REBI64 freed = cast(REBI64, GC_Ballast) - ballast;
+        freed += cast(REBI64, count) * sizeof(REBSER);
+        Update_Ballast(TG_Ballast - ballast, freed);
         GC_Ballast = TG_Ballast;
     }
 
@@ -1218,7 +2171,11 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
     // stack, so calling into the evaluator e.g. for rebPrint() may be bad.
     //
     if (Reb_Opts->watch_recycle) {
-        printf("RECYCLE: %u nodes\n", cast(unsigned int, count));
+        printf(
+            "RECYCLE: %u nodes%s\n",
+            cast(unsigned int, count),
+            minor ? " (minor)" : remark ? " (incremental)" : ""
+        );
         fflush(stdout);
     }
   #endif
@@ -1227,16 +2184,169 @@ REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Core: C
+//
+// Recycle memory no longer needed.  If sweeplist is not NULL, then it needs
+// to be a series whose width is sizeof(REBSER*), and it will be filled with
+// the list of series that *would* be recycled.
+//
+// This is always a full recycle, which considers all series nodes.
+//
+REBCNT Recycle_Core(bool shutdown, REBSER *sweeplist)
+{
+    const bool minor = false;
+    return Recycle_Generation_Core(shutdown, minor, sweeplist);
+}
+
+
+//
+//  Recycle_Minor: C
+//
+// Recycle only the series that were handed to the GC since the last recycle,
+// treating everything that survived that recycle as live.  If there's no
+// information on what survived (e.g. RECYCLE/GENERATIONAL was only just
+// turned on), then this does a full recycle instead.
+//
+REBCNT Recycle_Minor(void)
+{
+    const bool shutdown = false;
+    const bool minor = true;
+    return Recycle_Generation_Core(shutdown, minor, nullptr);
+}
+
+
+//
+//  Step_Incremental_Recycle: C
+//
+// Scan GC_Mark_Budget series, taking arrays from the mark stack first and
+// then the series that were written after a step scanned them.  When there
+// are none of either left the recycle is finished (with a final pause) and
+// the number of nodes it freed is returned, otherwise the result is 0.
+//
+// It's also finished if another ballast's worth of memory got allocated
+// since it started, as evaluation is outpacing the steps.
+//
+static REBCNT Step_Incremental_Recycle(void)
+{
+    assert(GC_Marking);
+
+    if (GC_Disabled) {
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
+    }
+
+    if (GC_Mark_Budget != 0 and GC_Ballast > 0) {  // RECYCLE/INCREMENTAL 0
+        REBCNT n = GC_Mark_Budget;
+        for (; n > 0; --n) {
+            if (SER_USED(GC_Mark_Stack) != 0) {
+                Propagate_One_GC_Mark();
+                continue;
+            }
+
+            if (SER_USED(GC_Remembered) == 0)
+                break;
+
+            // Series aren't freed between steps, so the entry is good.  But
+            // the series may be listed twice, see Mark_Remembered_Series().
+            //
+            REBCNT used = SER_USED(GC_Remembered) - 1;
+            SET_SERIES_USED(GC_Remembered, used);
+            REBSER *s = *SER_AT(REBSER*, GC_Remembered, used);
+            if (GET_SERIES_INFO(s, REMEMBERED)) {
+                CLEAR_SERIES_INFO(s, REMEMBERED);
+                Queue_Mark_Series_Contents(s);
+            }
+        }
+
+        if (n == 0)
+            return 0;
+    }
+
+    const bool shutdown = false;
+    const bool minor = false;
+    return Recycle_Generation_Core(shutdown, minor, nullptr);
+}
+
+
+//
+//  Start_Incremental_Recycle: C
+//
+// Begin a full recycle whose marking is spread out over steps, with
+// evaluation running in between.  Only the roots that can be found without
+// walking every node are queued here (Mark_Root_Series() is left for the
+// end).  Nothing is propagated until the first step.
+//
+// This is "tri-color" marking, with the colors in the info bits instead of
+// NODE_FLAG_MARKED (see Queue_Mark_Node_Deep()).  A series a step scanned
+// may be changed afterward to refer to one that no step reached.  The
+// Remember_Series() write barrier lists such series for the later steps to
+// scan again, as it does for old series in generational mode.  But since
+// not all writes use the barrier yet, the final pause still rescans every
+// scanned series along with the roots, see Remark_Scanned_Series().
+//
+// Series made during the steps aren't colored, and are only kept alive if
+// they get reached.  Series which were reached but became garbage before the
+// final pause will survive until the next recycle.
+//
+static REBCNT Start_Incremental_Recycle(void)
+{
+    assert(not GC_Marking);
+
+    if (GC_Disabled) {
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
+    }
+
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    if (GC_Any_Scanned)
+        Clear_Scanned_Series();  // left by generational recycles
+    assert(SER_USED(GC_Remembered) == 0);
+
+    Reify_Any_C_Valist_Frames();
+    TERM_ARRAY_LEN(BUF_COLLECT, ARR_LEN(BUF_COLLECT));
+
+    GC_Ballast = TG_Ballast;  // see Step_Incremental_Recycle()
+    GC_Marking = true;  // Propagate_All_GC_Marks() will leave the queue be
+    GC_Any_Scanned = true;
+
+    Mark_Symbol_Series();  // asserts nothing is queued, so must go first
+    Mark_Natives();
+    Mark_Scan_Cache();
+    Mark_Data_Stack();
+    Mark_Guarded_Nodes();
+    Mark_Frame_Stack_Deep();
+    Mark_Devices_Deep();
+
+    return Step_Incremental_Recycle();
+}
+
+
 //
 //  Recycle: C
 //
-// Recycle memory no longer needed.
+// Recycle memory no longer needed.  This is what's used when the ballast is
+// exhausted, so in generational mode it's usually a minor recycle...with a
+// full recycle done every MEM_MINORS_PER_FULL times as a fallback.
+//
+// If RECYCLE/INCREMENTAL set a budget, then the full recycles are done in
+// steps.  Until one is finished, each call takes another step (and so does
+// Do_Signals_Throws(), even when the ballast hasn't run out).
 //
 REBCNT Recycle(void)
 {
+    if (GC_Marking)
+        return Step_Incremental_Recycle();
+
     // Default to not passing the `shutdown` flag.
     //
-    REBCNT n = Recycle_Core(false, NULL);
+    const bool shutdown = false;
+    bool minor = GC_Generational and GC_Minor_Count < MEM_MINORS_PER_FULL;
+    if (not minor and GC_Mark_Budget != 0)
+        return Start_Incremental_Recycle();
+
+    REBCNT n = Recycle_Generation_Core(shutdown, minor, nullptr);
 
   #ifdef DOUBLE_RECYCLE_TEST
     //
@@ -1245,7 +2355,10 @@ REBCNT Recycle(void)
     // shouldn't crash.)  This is an expensive check, but helpful to try if
     // it seems a GC left things in a bad state that crashed a later GC.
     //
-    REBCNT n2 = Recycle_Core(false, NULL);
+    // (A full recycle after a minor one can legitimately find more garbage,
+    // so the second recycle is the same kind as the first.)
+    //
+    REBCNT n2 = Recycle_Generation_Core(shutdown, minor, nullptr);
     assert(n2 == 0);
   #endif
 
@@ -1299,6 +2412,32 @@ void Push_Guard_Node(const REBNOD *node)
 }
 
 
+//
+//  Remember_Scanned_Series: C
+//
+// The slow path of the Remember_Series() write barrier, for the first write
+// to an old series since the last recycle (or to a series scanned by a step
+// of an incremental recycle since then).  It's listed in GC_Remembered for
+// Mark_Remembered_Series() to look into.
+//
+void Remember_Scanned_Series(REBSER *s)
+{
+    assert(GET_SERIES_FLAG(s, MANAGED));
+
+    if (not GC_Generational and not GC_Marking)
+        return;  // old bits are stale, the next full recycle will clear them
+
+    SET_SERIES_INFO(s, REMEMBERED);
+
+    if (SER_FULL(GC_Remembered))
+        Extend_Series(GC_Remembered, 8);
+
+    *SER_AT(REBSER*, GC_Remembered, SER_USED(GC_Remembered)) = s;
+
+    SET_SERIES_USED(GC_Remembered, SER_USED(GC_Remembered) + 1);
+}
+
+
 //
 //  Startup_GC: C
 //
@@ -1320,6 +2459,68 @@ void Startup_GC(void)
     //
     GC_Mark_Stack = Make_Series(100, sizeof(REBARR*));
     TERM_SEQUENCE(GC_Mark_Stack);
+
+    // Log of series managed since the last recycle, for minor recycles.  It
+    // is fixed size, see Track_Young_Series() for what happens when full.
+    //
+    GC_Nursery = Make_Series(MEM_NURSERY_SIZE, sizeof(REBSER*));
+    TERM_SEQUENCE(GC_Nursery);
+
+    // Old series written since the last recycle, see Remember_Series().  And
+    // what a minor recycle marked outside the nursery, see Sweep_Nursery().
+    //
+    GC_Remembered = Make_Series(100, sizeof(REBSER*));
+    TERM_SEQUENCE(GC_Remembered);
+    GC_Minor_Marks = Make_Series(100, sizeof(REBNOD*));
+    TERM_SEQUENCE(GC_Minor_Marks);
+
+    // Pairings an incremental recycle reached, see Mark_Reached_Pairings()
+    //
+    GC_Reached_Pairings = Make_Series(100, sizeof(REBVAL*));
+    TERM_SEQUENCE(GC_Reached_Pairings);
+
+    // Bitmap of the garbage in a segment, for sweeping one at a time.  It
+    // must fit the biggest segment Fill_Pool() may make when pool tuning.
+    //
+    REBCNT units = Mem_Pools[SER_POOL].units;
+    if (units < MEM_HUGE_PAGE_SIZE / sizeof(REBSER))
+        units = MEM_HUGE_PAGE_SIZE / sizeof(REBSER);
+    REBCNT words = SWEEP_WORDS_PER_SEG(units);
+    GC_Sweep_Bits = Make_Series(words, sizeof(uintptr_t));
+
+  #if defined(USE_WORKER_THREADS)
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1)
+        GC_Sweep_Threads = 1;
+    else if (cpus > MEM_SWEEP_MAX_THREADS)
+        GC_Sweep_Threads = MEM_SWEEP_MAX_THREADS;
+    else
+        GC_Sweep_Threads = cast(REBCNT, cpus);
+  #else
+    GC_Sweep_Threads = 1;
+  #endif
+
+    // !!! Minor recycles are only sound if everything that writes to series
+    // uses Remember_Series() (see notes there), and not all code has been
+    // audited for that yet.  So generational mode has to be asked for, with
+    // RECYCLE/GENERATIONAL...which only works in builds that #define
+    // INCLUDE_GENERATIONAL_RECYCLE.  (Otherwise RECYCLE/MINOR is an error,
+    // and the hottest write paths skip the barrier, see Remember_Series().)
+    //
+    GC_Generational = false;
+    GC_Old_Known = false;
+    GC_Any_Scanned = false;
+    GC_Minor = false;
+    GC_Minor_Count = 0;
+    GC_Marking = false;
+    GC_Finishing = false;
+    GC_Mark_Budget = 0;
+
+    GC_Growth = MEM_GROWTH_PERCENT;
+    GC_Live_Bytes = 0;
+    GC_Survival = 0;
+    GC_Retain = MEM_RETAIN_PERCENT;
+    GC_Released = 0;
 }
 
 
@@ -1328,8 +2529,19 @@ void Startup_GC(void)
 //
 void Shutdown_GC(void)
 {
+    GC_Generational = false;  // don't log into freed nursery or remembered
+
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+    Free_Unmanaged_Series(GC_Nursery);
+    Free_Unmanaged_Series(GC_Remembered);
+    Free_Unmanaged_Series(GC_Minor_Marks);
+    Free_Unmanaged_Series(GC_Reached_Pairings);
+    Free_Unmanaged_Series(GC_Sweep_Bits);
+
+  #if defined(USE_WORKER_THREADS)
+    Stop_Sweep_Workers();
+  #endif
 }
 
 
@@ -1349,15 +2561,23 @@ static void Mark_Devices_Deep(void)
         if (not dev->pending)
             continue;
 
-        REBSER *req = SER(dev->pending);
-
         // This used to walk the ->next field of the REBREQ explicitly, and
         // mark the port pointers internal to the REBREQ.  Following the
         // links and marking the contexts is now done automatically, because
         // REBREQ is a REBSER node and has those fields in LINK()/MISC() with
         // SERIES_FLAG_LINK_NODE_NEEDS_MARK/SERIES_FLAG_MISC_NODE_NEEDS_MARK
         //
-        Queue_Mark_Node_Deep(req);
+        // But device code relinks the chain directly, so a minor recycle has
+        // to walk it to look into the old requests (and so does the final
+        // pause of an incremental one, for the requests a step scanned).
+        //
+        REBREQ *req = dev->pending;
+        if (not GC_Minor and not GC_Marking)
+            Queue_Mark_Node_Deep(req);
+        else {
+            for (; req != nullptr; req = NextReq(req))
+                Queue_Mark_Root_Series(SER(req));
+        }
     }
 
     Propagate_All_GC_Marks();
@@ -62,6 +62,10 @@
 #include "sys-core.h"
 #include "sys-int-funcs.h"
 
+#if defined(HAS_HUGE_PAGES)
+    #include <sys/mman.h>
+#endif
+
 
 //
 //  Alloc_Mem: C
@@ -212,6 +216,76 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 };
 
 
+#if defined(HAS_HUGE_PAGES)
+
+//
+//  Map_Huge_Segment: C
+//
+// Get MEM_HUGE_PAGE_SIZE bytes from the OS, aligned so the kernel can back
+// them with a transparent huge page.  Returns nullptr if it can't, and then
+// the caller just uses ALLOC_N().
+//
+static REBSEG *Map_Huge_Segment(void)
+{
+    const size_t size = MEM_HUGE_PAGE_SIZE;
+
+    // mmap() only promises alignment to small pages, so map twice as much
+    // and unmap what's around the aligned part.
+    //
+    void *p = mmap(
+        nullptr,
+        size * 2,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+    if (p == MAP_FAILED)
+        return nullptr;
+
+    REBYTE *start = cast(REBYTE*, p);
+    uintptr_t skip = (size - (cast(uintptr_t, start) % size)) % size;
+    if (skip != 0)
+        munmap(start, skip);
+    munmap(start + skip + size, size - skip);
+    start += skip;
+
+  #if defined(MADV_HUGEPAGE)
+    madvise(start, size, MADV_HUGEPAGE);  // just a hint, ok if it fails
+  #endif
+
+    PG_Mem_Usage += size;  // accounted like ALLOC_N() would
+    if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit)
+        Check_Security(Canon(SYM_MEMORY), POL_EXEC, 0);
+
+    REBSEG *seg = cast(REBSEG*, start);
+    seg->flags = SEG_FLAG_MAPPED;
+    return seg;
+}
+
+#endif
+
+
+//
+//  Free_Segment: C
+//
+// Give a segment's memory back, however Fill_Pool() got it.
+//
+static void Free_Segment(REBSEG *seg)
+{
+  #if defined(HAS_HUGE_PAGES)
+    if (seg->flags & SEG_FLAG_MAPPED) {
+        PG_Mem_Usage -= seg->size;
+        munmap(seg, seg->size);
+        return;
+    }
+  #endif
+
+    assert(not (seg->flags & SEG_FLAG_MAPPED));
+    FREE_N(char, seg->size, cast(char*, seg));
+}
+
+
 //
 //  Startup_Pools: C
 //
@@ -244,6 +318,7 @@ void Startup_Pools(REBINT scale)
     }
 
     Mem_Pools = ALLOC_N(REBPOL, MAX_POOLS);
+    TG_Magazines = ALLOC_N_ZEROFILL(REBMAG, MAX_POOLS);
 
     // Copy pool sizes to new pool structure:
     //
@@ -267,7 +342,10 @@ void Startup_Pools(REBINT scale)
         if (Mem_Pools[n].units < 2) Mem_Pools[n].units = 2;
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
+        Mem_Pools[n].requests = 0;
+        Mem_Pools[n].wasted = 0;
     }
+    PG_Pool_Tuning = false;
 
     // For pool lookup. Maps size to pool index. (See Find_Pool below)
     PG_Pool_Map = ALLOC_N(REBYTE, (4 * MEM_BIG_SIZE) + 1);
@@ -320,7 +398,7 @@ void Shutdown_Pools(void)
     for(; debug_seg != NULL; debug_seg = debug_seg->next) {
         REBSER *series = cast(REBSER*, debug_seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--, series++) {
+        for (n = debug_seg->units; n > 0; n--, series++) {
             if (IS_FREE_NODE(series))
                 continue;
 
@@ -335,18 +413,18 @@ void Shutdown_Pools(void)
     REBCNT pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
         REBPOL *pool = &Mem_Pools[pool_num];
-        REBCNT mem_size = pool->wide * pool->units + sizeof(REBSEG);
 
         REBSEG *seg = pool->segs;
         while (seg) {
             REBSEG *next;
             next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            Free_Segment(seg);
             seg = next;
         }
     }
 
     FREE_N(REBPOL, MAX_POOLS, Mem_Pools);
+    FREE_N(REBMAG, MAX_POOLS, TG_Magazines);  // nodes were in the segments
 
     FREE_N(REBYTE, (4 * MEM_BIG_SIZE) + 1, PG_Pool_Map);
 
@@ -389,12 +467,38 @@ void Shutdown_Pools(void)
 // the size and units specified when the pool header was created.  The nodes
 // of the pool are linked to the free list.
 //
+// If PG_Pool_Tuning is on, a pool that's been filled before gets a segment
+// with as many nodes as it already has, up to a MEM_HUGE_PAGE_SIZE segment.
+// So busy pools wind up in a few big segments, and idle ones stay small.
+//
 void Fill_Pool(REBPOL *pool)
 {
     REBCNT units = pool->units;
-    REBCNT mem_size = pool->wide * units + sizeof(REBSEG);
+    REBSEG *seg = nullptr;
+
+    REBCNT huge_units = (MEM_HUGE_PAGE_SIZE - sizeof(REBSEG)) / pool->wide;
+    if (PG_Pool_Tuning and huge_units > units) {
+        if (pool->has > units)
+            units = pool->has;
+        if (units >= huge_units) {
+            units = huge_units;
+
+          #if defined(HAS_HUGE_PAGES)
+            seg = Map_Huge_Segment();
+          #endif
+        }
+    }
+
+    REBCNT mem_size;
+    if (seg)
+        mem_size = MEM_HUGE_PAGE_SIZE;
+    else {
+        mem_size = pool->wide * units + sizeof(REBSEG);
+        seg = cast(REBSEG *, ALLOC_N(char, mem_size));
+        if (seg)
+            seg->flags = 0;
+    }
 
-    REBSEG *seg = cast(REBSEG *, ALLOC_N(char, mem_size));
     if (seg == NULL) {
         panic ("Out of memory error during Fill_Pool()");
 
@@ -408,6 +512,7 @@ void Fill_Pool(REBPOL *pool)
     }
 
     seg->size = mem_size;
+    seg->units = units;
     seg->next = pool->segs;
     pool->segs = seg;
     pool->has += units;
@@ -446,6 +551,248 @@ void Fill_Pool(REBPOL *pool)
 }
 
 
+//
+//  Refill_Magazine: C
+//
+// Move up to MEM_MAGAZINE_SIZE nodes from a pool's free list into the
+// magazine for that pool (which must be empty), filling the pool first if it
+// has no free nodes.
+//
+void Refill_Magazine(REBCNT pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBMAG *mag = &TG_Magazines[pool_id];
+    assert(mag->count == 0);
+
+    if (not pool->first)  // pool has run out of nodes
+        Fill_Pool(pool);  // refill it
+
+    REBCNT n = 0;
+    while (n < MEM_MAGAZINE_SIZE and pool->first) {
+        REBNOD *node = pool->first;
+        pool->first = node->next_if_free;
+        if (node == pool->last)
+            pool->last = nullptr;
+
+        node->next_if_free = mag->first;
+        mag->first = node;
+        ++n;
+    }
+
+    pool->free -= n;
+    mag->count = n;
+}
+
+
+//
+//  Flush_Magazine: C
+//
+// Give MEM_MAGAZINE_SIZE nodes from a pool's magazine back to the pool, so
+// freeing more than is allocated doesn't hoard them there.  (They go on the
+// head of the free list, as R3-Alpha's Free_Node() did.)
+//
+void Flush_Magazine(REBCNT pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBMAG *mag = &TG_Magazines[pool_id];
+    assert(mag->count >= MEM_MAGAZINE_SIZE);
+
+    REBCNT n;
+    for (n = 0; n < MEM_MAGAZINE_SIZE; ++n) {
+        REBNOD *node = mag->first;
+        mag->first = node->next_if_free;
+
+        node->next_if_free = pool->first;
+        pool->first = node;
+        if (not pool->last)
+            pool->last = node;  // first pushed onto an empty list is the tail
+    }
+
+    mag->count -= MEM_MAGAZINE_SIZE;
+    pool->free += MEM_MAGAZINE_SIZE;
+}
+
+
+//
+//  Splice_Free_Nodes: C
+//
+// Give a pool a list of nodes that were freed without going through the
+// magazine, e.g. by sweep workers (see Release_Sweep_Garbage()).  They are
+// linked by `next_if_free` from `first` to `last`, and are already marked
+// with FREED_SERIES_BYTE.  Like Free_Node(), the debug build puts them at
+// the end of the free list, so they aren't handed out again right away.
+//
+void Splice_Free_Nodes(
+    REBCNT pool_id,
+    REBNOD *first,
+    REBNOD *last,
+    REBCNT count
+){
+    REBPOL *pool = &Mem_Pools[pool_id];
+
+    if (not pool->first) {
+        pool->first = first;
+        pool->last = last;
+        last->next_if_free = nullptr;
+    }
+    else {
+      #ifdef NDEBUG
+        last->next_if_free = pool->first;
+        pool->first = first;
+      #else
+        pool->last->next_if_free = first;
+        pool->last = last;
+        last->next_if_free = nullptr;
+      #endif
+    }
+
+    pool->free += count;
+}
+
+
+static int Compare_Segment_Addresses(void *thunk, const void *a, const void *b)
+{
+    UNUSED(thunk);
+    uintptr_t seg_a = cast(uintptr_t, *cast(REBSEG* const*, a));
+    uintptr_t seg_b = cast(uintptr_t, *cast(REBSEG* const*, b));
+    return seg_a < seg_b ? -1 : seg_a > seg_b ? 1 : 0;
+}
+
+
+// Binary search of segments sorted by address for the one holding a node.
+//
+static REBCNT Find_Segment_Index(REBSEG **segs, REBCNT num_segs, REBNOD *node)
+{
+    REBCNT lo = 0;
+    REBCNT hi = num_segs;
+    while (hi - lo > 1) {
+        REBCNT mid = lo + (hi - lo) / 2;
+        if (cast(REBYTE*, segs[mid]) < cast(REBYTE*, node))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    assert(cast(REBYTE*, segs[lo] + 1) <= cast(REBYTE*, node));
+    return lo;
+}
+
+
+//
+//  Release_Free_Segments: C
+//
+// Give segments whose nodes are all free back to the OS (or the C heap), so
+// a burst of allocation doesn't keep its memory for the life of the process.
+// Nodes are never moved, so only segments that happen to be wholly free can
+// be released.  This is done after the sweep of full recycles.
+//
+// Each pool keeps free nodes adding up to at least `retain` percent of the
+// nodes it has in use (and at least one segment's worth of its spec'd size)
+// so that it doesn't have to go right back to Fill_Pool().
+//
+// Returns the number of bytes released.
+//
+REBU64 Release_Free_Segments(REBCNT retain)
+{
+    REBU64 released = 0;
+
+    REBCNT pool_id;
+    for (pool_id = 0; pool_id != SYSTEM_POOL; ++pool_id) {
+        REBPOL *pool = &Mem_Pools[pool_id];
+        REBMAG *mag = &TG_Magazines[pool_id];
+
+        REBCNT free = pool->free + mag->count;
+        REBU64 keep = cast(REBU64, pool->has - free) * retain / 100;
+        if (keep < pool->units)
+            keep = pool->units;
+        if (free <= keep)
+            continue;  // no segment could be released
+
+        REBCNT num_segs = 0;
+        REBSEG *seg;
+        for (seg = pool->segs; seg != nullptr; seg = seg->next)
+            ++num_segs;
+
+        REBSEG **segs = ALLOC_N(REBSEG*, num_segs);
+        REBCNT *counts = ALLOC_N_ZEROFILL(REBCNT, num_segs);
+        if (not segs or not counts) {  // not worth failing over
+            if (segs)
+                FREE_N(REBSEG*, num_segs, segs);
+            if (counts)
+                FREE_N(REBCNT, num_segs, counts);
+            continue;
+        }
+
+        REBCNT i = 0;
+        for (seg = pool->segs; seg != nullptr; seg = seg->next)
+            segs[i++] = seg;
+        reb_qsort_r(
+            segs, num_segs, sizeof(REBSEG*), nullptr, &Compare_Segment_Addresses
+        );
+
+        // Nodes in the magazine are put back on the pool's free list, so
+        // they are counted...and none are left in a released segment.
+        //
+        while (mag->count != 0) {
+            REBNOD *node = mag->first;
+            mag->first = node->next_if_free;
+
+            node->next_if_free = pool->first;
+            pool->first = node;
+            if (not pool->last)
+                pool->last = node;
+
+            --mag->count;
+            ++pool->free;
+        }
+
+        REBNOD *node;
+        for (node = pool->first; node != nullptr; node = node->next_if_free)
+            ++counts[Find_Segment_Index(segs, num_segs, node)];
+
+        bool any = false;
+        for (i = 0; i < num_segs; ++i) {
+            seg = segs[i];
+            if (counts[i] != seg->units or pool->free - seg->units < keep)
+                continue;
+            seg->flags |= SEG_FLAG_RELEASE;
+            pool->free -= seg->units;
+            pool->has -= seg->units;
+            any = true;
+        }
+
+        if (any) {
+            REBNOD **link = &pool->first;  // unlink nodes in those segments
+            pool->last = nullptr;
+            while ((node = *link) != nullptr) {
+                i = Find_Segment_Index(segs, num_segs, node);
+                if (segs[i]->flags & SEG_FLAG_RELEASE)
+                    *link = node->next_if_free;
+                else {
+                    pool->last = node;
+                    link = &node->next_if_free;
+                }
+            }
+
+            REBSEG **seg_link = &pool->segs;
+            while ((seg = *seg_link) != nullptr) {
+                if (seg->flags & SEG_FLAG_RELEASE) {
+                    *seg_link = seg->next;
+                    released += seg->size;
+                    Free_Segment(seg);
+                }
+                else
+                    seg_link = &seg->next;
+            }
+        }
+
+        FREE_N(REBSEG*, num_segs, segs);
+        FREE_N(REBCNT, num_segs, counts);
+    }
+
+    return released;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -462,7 +809,7 @@ REBNOD *Try_Find_Containing_Node_Debug(const void *p)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = seg->units; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -688,6 +1035,8 @@ void Expand_Series(REBSER *s, REBCNT index, REBCNT delta)
 
     if (delta == 0) return;
 
+    Remember_Series(s);  // new cells are about to be written
+
     REBCNT used_old = SER_USED(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -904,6 +1253,9 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     // which includes whether the series is dynamic or if the data lives in
     // the node itself, the width (right 8 bits), etc.
 
+    Remember_Series(a);  // each may now refer to what only the other did
+    Remember_Series(b);
+
     REBYTE a_len = LEN_BYTE_OR_255(a); // indicates dynamic if 255
     mutable_LEN_BYTE_OR_255(a) = LEN_BYTE_OR_255(b);
     mutable_LEN_BYTE_OR_255(b) = a_len;
@@ -1031,6 +1383,21 @@ void Decay_Series(REBSER *s)
         else
             Free_Bookmarks_Maybe_Null(STR(s));
     }
+    else if (IS_SER_ARRAY(s)) {
+        Forget_Parse_Program(ARR(s));
+
+        // A node reused for a new keylist mustn't get the old one's answers
+        // from Is_Overriding_Context().
+        //
+        if (
+            (s->header.bits & (
+                KEYLIST_FLAG_OVERRIDE_CACHED
+                    | ARRAY_FLAG_IS_VARLIST | ARRAY_FLAG_IS_PARAMLIST
+            )) == KEYLIST_FLAG_OVERRIDE_CACHED
+        ){
+            ++TG_Shape_Version;
+        }
+    }
 
     // Remove series from expansion list, if found:
     REBCNT n;
@@ -1248,7 +1615,7 @@ REBCNT Check_Memory_Debug(void)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = seg->units; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1328,7 +1695,7 @@ void Dump_All_Series_Of_Size(REBCNT size)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = seg->units; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1358,7 +1725,7 @@ void Dump_Series_In_Pool(REBCNT pool_id)
     for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
         REBSER *s = cast(REBSER*, seg + 1);
         REBCNT n = 0;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; --n, ++s) {
+        for (n = seg->units; n > 0; --n, ++s) {
             if (IS_FREE_NODE(s))
                 continue;
 
@@ -1401,7 +1768,8 @@ void Dump_Pools(void)
         for (seg = Mem_Pools[n].segs; seg; seg = seg->next, segs++)
             size += seg->size;
 
-        REBCNT used = Mem_Pools[n].has - Mem_Pools[n].free;
+        REBCNT magazine = TG_Magazines[n].count;  // free, see REBMAG
+        REBCNT used = Mem_Pools[n].has - Mem_Pools[n].free - magazine;
         printf(
             "Pool[%-2d] %5dB %-5d/%-5d:%-4d (%3d%%) ",
             cast(int, n),
@@ -1413,7 +1781,19 @@ void Dump_Pools(void)
                 Mem_Pools[n].has != 0 ? ((used * 100) / Mem_Pools[n].has) : 0
             )
         );
-        printf("%-2d segs, %-7d total\n", cast(int, segs), cast(int, size));
+        printf(
+            "%-2d segs, %-7d total, %-3d in magazine\n",
+            cast(int, segs),
+            cast(int, size),
+            cast(int, magazine)
+        );
+
+        if (Mem_Pools[n].requests != 0)
+            printf(
+                "    %lu requests, %lu bytes wasted\n",
+                cast(unsigned long, Mem_Pools[n].requests),
+                cast(unsigned long, Mem_Pools[n].wasted)
+            );
 
         tused += used * Mem_Pools[n].wide;
         total += size;
@@ -1426,6 +1806,12 @@ void Dump_Pools(void)
         cast(int, (tused * 100) / total)
     );
     printf("System pool used %d\n", cast(int, Mem_Pools[SYSTEM_POOL].has));
+    if (Mem_Pools[SYSTEM_POOL].requests != 0)
+        printf(
+            "    %lu requests, %lu bytes wasted\n",
+            cast(unsigned long, Mem_Pools[SYSTEM_POOL].requests),
+            cast(unsigned long, Mem_Pools[SYSTEM_POOL].wasted)
+        );
     printf("Raw allocator reports %lu\n", cast(unsigned long, PG_Mem_Usage));
 
     fflush(stdout);
@@ -1464,7 +1850,7 @@ REBU64 Inspect_Series(bool show)
         REBSER *s = cast(REBSER*, seg + 1);
 
         REBCNT n;
-        for (n = Mem_Pools[SER_POOL].units; n > 0; n--) {
+        for (n = seg->units; n > 0; n--) {
             if (IS_FREE_NODE(s)) {
                 ++fre;
                 continue;
@@ -1499,7 +1885,8 @@ REBU64 Inspect_Series(bool show)
     REBU64 fre_size = 0;
     REBINT pool_num;
     for (pool_num = 0; pool_num != SYSTEM_POOL; pool_num++) {
-        fre_size += Mem_Pools[pool_num].free * Mem_Pools[pool_num].wide;
+        REBCNT free = Mem_Pools[pool_num].free + TG_Magazines[pool_num].count;
+        fre_size += free * Mem_Pools[pool_num].wide;
     }
 
     if (show) {
@@ -301,8 +301,14 @@ void Remove_Series_Len(REBSER *s, REBCNT index, REBINT len)
         assert(len <= len_old);
 
         Remove_Series_Units(s, cp - STR_HEAD(str), ep - cp);
-        Free_Bookmarks_Maybe_Null(str);
+        Update_Bookmarks(
+            str, index, cast(REBCNT, len), 0, - cast(REBINT, ep - cp)
+        );
         SET_STR_LEN_SIZE(str, len_old - len, size_old - (ep - cp));
+
+      #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
+        Check_Bookmarks_Debug(str);
+      #endif
     }
     else
         Remove_Series_Units(s, index, len);
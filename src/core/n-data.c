@@ -191,9 +191,10 @@ REBNATIVE(bind)
     if (not ANY_ARRAY_OR_PATH(v))
         fail (PAR(value)); // QUOTED! could have been any type
 
-    RELVAL *at;
+    REBARR *array;
+    REBCNT index;
     if (REF(copy)) {
-        REBARR *copy = Copy_Array_Core_Managed(
+        array = Copy_Array_Core_Managed(
             VAL_ARRAY(v),
             VAL_INDEX(v), // at
             VAL_SPECIFIER(v),
@@ -202,16 +203,18 @@ REBNATIVE(bind)
             ARRAY_MASK_HAS_FILE_LINE, // flags
             TS_ARRAY // types to copy deeply
         );
-        at = ARR_HEAD(copy);
-        Init_Any_Array(D_OUT, VAL_TYPE(v), copy);
+        index = 0;
+        Init_Any_Array(D_OUT, VAL_TYPE(v), array);
     }
     else {
-        at = VAL_ARRAY_AT(v); // only affects binding from current index
+        array = VAL_ARRAY(v);
+        index = VAL_INDEX(v); // only affects binding from current index
         Move_Value(D_OUT, v);
     }
 
     Bind_Values_Core(
-        at,
+        array,
+        index,
         context,
         bind_types,
         add_midstream_types,
@@ -287,7 +290,7 @@ REBNATIVE(in)
 
     // Special form: IN object block
     if (IS_BLOCK(word) or IS_GROUP(word)) {
-        Bind_Values_Deep(VAL_ARRAY_HEAD(word), context);
+        Bind_Values_Deep(VAL_ARRAY(word), 0, context);
         Quotify(word, num_quotes);
         RETURN (word);
     }
@@ -467,7 +470,9 @@ REBNATIVE(unbind)
     if (ANY_WORD(word))
         Unbind_Any_Word(word);
     else
-        Unbind_Values_Core(VAL_ARRAY_AT(word), NULL, REF(deep));
+        Unbind_Values_Core(
+            VAL_ARRAY(word), VAL_INDEX(word), nullptr, REF(deep)
+        );
 
     RETURN (word);
 }
@@ -1130,38 +1135,29 @@ REBNATIVE(as)
                     if (GET_CELL_FLAG(v, CONST))
                         fail (Error_Alias_Constrains_Raw());
 
-                bool all_ascii = true;
-                REBCNT num_codepoints = 0;
-
-                index = 0;
-
-                REBSIZ bytes_left = BIN_LEN(bin);
-                const REBYTE *bp = BIN_HEAD(bin);
-                for (; bytes_left > 0; --bytes_left, ++bp) {
-                    if (bp < at_ptr)
-                        ++index;
-
-                    REBUNI c = *bp;
-                    if (c >= 0x80) {
-                        bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-                        if (bp == NULL)  // !!! Should Back_Scan() fail?
-                            fail (Error_Bad_Utf8_Raw());
-
-                        all_ascii = false;
-                    }
-
-                    ++num_codepoints;
+                // The part before the position is checked on its own, which
+                // gives the index in codepoints along with the length.
+                //
+                REBSIZ size = BIN_LEN(bin);
+                REBCNT num_codepoints;
+                if (
+                    Check_UTF8(&index, BIN_HEAD(bin), offset) != offset
+                    or Check_UTF8(
+                        &num_codepoints, at_ptr, size - offset
+                    ) != size - offset
+                ){
+                    fail (Error_Bad_Utf8_Raw());
                 }
+                num_codepoints += index;
+
                 SET_SERIES_FLAG(bin, IS_STRING);
                 SET_SERIES_FLAG(bin, UTF8_NONWORD);
                 str = STR(bin);
 
+                LINK(bin).bookmarks = nullptr;  // before SET_STR_LEN_SIZE()
                 SET_STR_LEN_SIZE(str, num_codepoints, BIN_LEN(bin));
-                LINK(bin).bookmarks = nullptr;
 
                 // !!! TBD: cache index/offset
-
-                UNUSED(all_ascii);  // TBD: maintain cache
             }
             else {
                 // !!! It's a string series, but or mapping acceleration is
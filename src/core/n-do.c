@@ -772,6 +772,7 @@ REBNATIVE(applique)
     // like R3-Alpha's MAKE OBJECT!.  See Virtual_Bind_Deep_To_New_Context()
     // for potential future directions.
     //
+    Remember_Series(SER(VAL_ARRAY(ARG(def))));  // see Bind_Values_Core()
     Bind_Values_Inner_Loop(
         &binder,
         VAL_ARRAY_HEAD(ARG(def)), // !!! bindings are mutated!  :-(
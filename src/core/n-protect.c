@@ -154,6 +154,8 @@ static void Protect_Key(REBCTX *context, REBCNT index, REBFLGS flags)
 
         REBVAL *key = CTX_KEY(context, index);
 
+        ++TG_Shape_Version;  // see Is_Overriding_Context()
+
         if (flags & PROT_SET) {
             TYPE_SET(key, REB_TS_HIDDEN);
             TYPE_SET(key, REB_TS_UNBINDABLE);
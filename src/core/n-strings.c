@@ -575,7 +575,8 @@ REBNATIVE(deline)
         dest = WRITE_CHR(dest, c);
     }
 
-    TERM_STR_LEN_SIZE(s, len_head, dest - VAL_STRING_AT(val));
+    Trim_Bookmarks(s, VAL_INDEX(val));  // content after it was rewritten
+    TERM_STR_LEN_SIZE(s, len_head, dest - STR_HEAD(s));
 
     RETURN (ARG(string));
 }
@@ -631,6 +632,7 @@ REBNATIVE(enline)
     REBCNT old_len = MISC(s).length;
     EXPAND_SERIES_TAIL(SER(s), delta);  // corrupts MISC(str).length
     MISC(s).length = old_len + delta;  // just adding CR's
+    Trim_Bookmarks(s, idx);  // CR's will be slid into content after index
 
     // !!! After the UTF-8 Everywhere conversion, this will be able to stay
     // a byte-oriented process..because UTF-8 doesn't reuse ASCII chars in
@@ -918,6 +920,130 @@ REBNATIVE(find_script)
 }
 
 
+static void cleanup_searcher(const REBVAL *v)
+{
+    Free_Searcher(VAL_HANDLE_POINTER(struct Reb_Searcher, v));
+}
+
+
+//
+//  searcher: native [
+//
+//  {Make a HANDLE! for FIND-ANY to look for any of several patterns at once}
+//
+//      return: [handle!]
+//      patterns "TEXT! and BINARY! patterns (any BAR!s between are skipped)"
+//          [block!]
+//      /case "Case-sensitive (else TEXT! and ASCII letters are lowercased)"
+//  ]
+//
+REBNATIVE(searcher)
+{
+    INCLUDE_PARAMS_OF_SEARCHER;
+
+    struct Reb_Searcher *s = Make_Searcher(
+        VAL_ARRAY_AT(ARG(patterns)),
+        VAL_SPECIFIER(ARG(patterns)),
+        not REF(case)
+    );
+    return Init_Handle_Cdata_Managed(
+        D_OUT,
+        s,
+        sizeof(struct Reb_Searcher),
+        &cleanup_searcher
+    );
+}
+
+
+//
+//  find-any: native [
+//
+//  {Find where the first match of any of several patterns starts}
+//
+//      return: "Position of the match, or null if none of the patterns occur"
+//          [<opt> any-string! binary! integer!]
+//      series [<blank> any-string! binary!]
+//      patterns "Block of TEXT! and BINARY!, or a HANDLE! made by SEARCHER"
+//          [block! handle!]
+//      /part "Limits the search to a given length or position"
+//          [any-number! any-series! pair!]
+//      /case "Case-sensitive (only for a BLOCK! of patterns)"
+//      /tail "Returns the end of the match"
+//      /which "Returns the number of the pattern matched instead"
+//  ]
+//
+// Where several patterns match at the same position, the first one in the
+// block is the match--as with PARSE alternates.  Searching with a SEARCHER
+// of the patterns saves making one for every call.
+//
+REBNATIVE(find_any)
+{
+    INCLUDE_PARAMS_OF_FIND_ANY;
+
+    REBVAL *series = ARG(series);
+
+    // A bad /PART fails, so this comes before a searcher may be made (which
+    // has to be freed).
+    //
+    REBCNT tail;
+    if (REF(part))
+        tail = Part_Tail_May_Modify_Index(series, ARG(part));
+    else
+        tail = VAL_LEN_HEAD(series);
+
+    struct Reb_Searcher *s;
+    if (IS_HANDLE(ARG(patterns))) {
+        if (VAL_HANDLE_CLEANER(ARG(patterns)) != &cleanup_searcher)
+            fail (PAR(patterns));
+        if (REF(case))
+            fail (Error_Bad_Refines_Raw());
+
+        s = VAL_HANDLE_POINTER(struct Reb_Searcher, ARG(patterns));
+    }
+    else
+        s = Make_Searcher(
+            VAL_ARRAY_AT(ARG(patterns)),
+            VAL_SPECIFIER(ARG(patterns)),
+            not REF(case)
+        );
+
+    // A valid UTF-8 pattern can only match where a character starts, and
+    // ends where one ends.  Others could match part of a character.
+    //
+    if (ANY_STRING(series) and not s->whole_chars) {
+        if (not IS_HANDLE(ARG(patterns)))
+            Free_Searcher(s);
+        fail ("BINARY! patterns must be valid UTF-8 to search strings");
+    }
+
+    REBCNT len;
+    REBCNT which;
+    REBCNT index = NOT_FOUND;
+    if (VAL_INDEX(series) < tail)
+        index = Find_With_Searcher(
+            &len,
+            &which,
+            s,
+            VAL_SERIES(series),
+            VAL_INDEX(series),
+            tail,
+            ANY_STRING(series)
+        );
+
+    if (not IS_HANDLE(ARG(patterns)))
+        Free_Searcher(s);
+
+    if (index == NOT_FOUND)
+        return nullptr;
+
+    if (REF(which))
+        return Init_Integer(D_OUT, which + 1);
+
+    Move_Value(D_OUT, series);
+    VAL_INDEX(D_OUT) = REF(tail) ? index + len : index;
+    return D_OUT;
+}
+
 //
 //  invalid-utf8?: native [
 //
@@ -936,17 +1062,11 @@ REBNATIVE(invalid_utf8_q)
     REBYTE *utf8 = VAL_BIN_AT(arg);
     REBSIZ size = VAL_LEN_AT(arg);
 
-    REBYTE *end = utf8 + size;
+    REBSIZ valid = Check_UTF8(nullptr, utf8, size);
+    if (valid == size)
+        return nullptr;  // no invalid byte found
 
-    REBCNT trail;
-    for (; utf8 != end; utf8 += trail) {
-        trail = trailingBytesForUTF8[*utf8] + 1;
-        if (utf8 + trail > end or not isLegalUTF8(utf8, trail)) {
-            Move_Value(D_OUT, arg);
-            VAL_INDEX(D_OUT) = utf8 - VAL_BIN_HEAD(arg);
-            return D_OUT;
-        }
-    }
-
-    return nullptr;  // no invalid byte found
+    Move_Value(D_OUT, arg);
+    VAL_INDEX(D_OUT) += valid;
+    return D_OUT;
 }
@@ -102,9 +102,20 @@ REBNATIVE(exit_rebol)
 //          [<opt> integer!]
 //      /off "Disable auto-recycling"
 //      /on "Enable auto-recycling"
-//      /ballast "Trigger for auto-recycle (memory used)"
+//      /ballast "Trigger for auto-recycle (memory used), minimum if growth"
+//          [integer!]
+//      /growth "Trigger as percent of memory in use after recycle (0: off)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /minor "Only recycle series made since last recycle (/GENERATIONAL)"
+//      /generational "Make automatic recycles usually be minor ones"
+//          [logic!]
+//      /incremental "Arrays to mark per step of full automatic recycles"
+//          [integer!]
+//      /tune "Grow pool segments with demand (to huge pages), see STATS/POOLS"
+//          [logic!]
+//      /retain "Free pool memory kept by full recycles, as percent of used"
+//          [integer!]
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -128,11 +139,39 @@ REBNATIVE(recycle)
         TG_Ballast = TG_Max_Ballast;
     }
 
+    if (REF(growth))
+        GC_Growth = VAL_UINT32(ARG(growth));
+
     if (REF(torture)) {
         GC_Disabled = false;
         TG_Ballast = 0;
     }
 
+    if (REF(generational)) {
+      #if defined(INCLUDE_GENERATIONAL_RECYCLE)
+        GC_Generational = VAL_LOGIC(ARG(generational));
+        GC_Old_Known = false;  // writes weren't remembered while it was off
+      #else
+        fail ("RECYCLE/GENERATIONAL needs INCLUDE_GENERATIONAL_RECYCLE");
+      #endif
+    }
+
+    if (REF(incremental))  // 0 means automatic full recycles aren't split
+        GC_Mark_Budget = VAL_UINT32(ARG(incremental));
+
+    if (REF(retain))
+        GC_Retain = VAL_UINT32(ARG(retain));
+
+    if (REF(tune)) {
+        PG_Pool_Tuning = VAL_LOGIC(ARG(tune));
+
+        REBCNT n;
+        for (n = 0; n != MAX_POOLS; ++n) {  // histogram starts over
+            Mem_Pools[n].requests = 0;
+            Mem_Pools[n].wasted = 0;
+        }
+    }
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -159,9 +198,17 @@ REBNATIVE(recycle)
         assert(recount == count);
       #endif
     }
-    else {
-        count = Recycle();
+    else if (REF(minor)) {
+      #if defined(INCLUDE_GENERATIONAL_RECYCLE)
+        if (not GC_Generational)
+            fail ("RECYCLE/MINOR needs RECYCLE/GENERATIONAL turned on");
+        count = Recycle_Minor();
+      #else
+        fail ("RECYCLE/MINOR needs INCLUDE_GENERATIONAL_RECYCLE");
+      #endif
     }
+    else
+        count = Recycle_Core(false, nullptr);  // explicit RECYCLE is full
 
     if (REF(watch)) {
       #if defined(NDEBUG)
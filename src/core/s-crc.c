@@ -136,38 +136,115 @@ REBINT Compute_CRC24(const REBYTE *str, REBCNT len)
 }
 
 
+// Interning hashes many spellings, so Hash_UTF8() uses a hash that mixes in
+// 8 bytes at a time, in the style of wyhash:
+//
+// https://github.com/wangyi-fudan/wyhash
+//
+#define HASH_SEED_0 UINT64_C(0xA0761D6478BD642F)
+#define HASH_SEED_1 UINT64_C(0xE7037ED1A0B428DB)
+#define HASH_SEED_2 UINT64_C(0x8EBC6AF09C88C6E3)
+
+#define HASH_BYTES(b) (UINT64_C(0x0101010101010101) * (b))
+
+// Multiply two 64-bit numbers to 128 bits, and fold the halves together.
+//
+inline static REBU64 Hash_Mix(REBU64 a, REBU64 b)
+{
+  #if defined(__SIZEOF_INT128__)
+    __uint128_t r = cast(__uint128_t, a) * b;
+    return cast(REBU64, r) ^ cast(REBU64, r >> 64);
+  #else
+    REBU64 ha = a >> 32;
+    REBU64 hb = b >> 32;
+    REBU64 la = cast(uint32_t, a);
+    REBU64 lb = cast(uint32_t, b);
+    REBU64 rm0 = ha * lb;
+    REBU64 rm1 = hb * la;
+    REBU64 rl = la * lb;
+    REBU64 t = rl + (rm0 << 32);
+    REBU64 lo = t + (rm1 << 32);
+    REBU64 carry = (t < rl) + (lo < t);
+    REBU64 hi = ha * hb + (rm0 >> 32) + (rm1 >> 32) + carry;
+    return lo ^ hi;
+  #endif
+}
+
+// Lowercase 8 ASCII bytes at once.  The high bit of each byte is free, so
+// adding to every byte finds which are from A to Z without any carries from
+// one byte into the next.
+//
+inline static REBU64 Lowercase_Ascii_Word(REBU64 word)
+{
+    REBU64 ge_a = word + HASH_BYTES(0x80 - 'A');
+    REBU64 gt_z = word + HASH_BYTES(0x7F - 'Z');
+    REBU64 upper = ge_a & ~gt_z & HASH_BYTES(0x80);
+    return word | (upper >> 2);  // 0x80 >> 2 is the 0x20 case bit
+}
+
+
 //
 //  Hash_UTF8: C
 //
 // Return a case insensitive hash value for the string.
 //
+// What gets hashed is the UTF-8 of the lowercase form of each codepoint, so
+// spellings that differ only in case hash the same even if the lowercase
+// has a different size (e.g. KELVIN SIGN lowercases to "k").  Those bytes
+// are mixed in 8 at a time, and runs of 8 ASCII bytes are lowercased all at
+// once.  (The bytes are always read into the 64-bit word with memcpy(), so
+// the two ways agree on any platform.)
+//
 REBINT Hash_UTF8(const REBYTE *utf8, REBSIZ size)
 {
-    REBINT hash =
-        cast(REBINT, size) + cast(REBINT, cast(REBYTE, LO_CASE(*utf8)));
-
-    for (; size != 0; ++utf8, --size) {
-        REBUNI n = *utf8;
+    const REBYTE *end = utf8 + size;
+
+    REBU64 hash = HASH_SEED_0;
+    REBU64 total = 0;  // size of the lowercased UTF-8
+    REBU64 word;
+
+    REBYTE lower[8 + 4];  // lowercased bytes that aren't mixed in yet
+    REBCNT pending = 0;
+
+    while (utf8 != end) {
+        if (pending == 0 and end - utf8 >= 8) {
+            memcpy(&word, utf8, 8);
+            if (not (word & HASH_BYTES(0x80))) {  // all ASCII
+                word = Lowercase_Ascii_Word(word);
+                hash = Hash_Mix(word ^ HASH_SEED_1, hash);
+                total += 8;
+                utf8 += 8;
+                continue;
+            }
+        }
 
-        if (n >= 0x80) {
-            utf8 = Back_Scan_UTF8_Char(&n, utf8, &size);
+        REBUNI c = *utf8;
+        if (c >= 0x80) {
+            REBSIZ bytes_left = end - utf8;
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &bytes_left);
             assert(utf8 != NULL); // should have already been verified good
         }
+        ++utf8;
+
+        pending += Encode_UTF8_Char(&lower[pending], LO_CASE(c));
+        if (pending >= 8) {
+            memcpy(&word, lower, 8);
+            hash = Hash_Mix(word ^ HASH_SEED_1, hash);
+            total += 8;
+            pending -= 8;
+            memmove(lower, &lower[8], pending);
+        }
+    }
 
-        // Optimize `n = cast(REBYTE, LO_CASE(n))` (drop upper 8 bits)
-        // !!! Is this actually faster?
-        //
-        n = cast(REBYTE, LO_CASE(n));
-
-        n = cast(REBYTE, (hash >> CRCSHIFTS) ^ n);
-
-        // Left shift math must use unsigned to avoid undefined behavior
-        // http://stackoverflow.com/q/3784996/211160
-        //
-        hash = cast(REBINT, MASK_CRC(cast(REBCNT, hash) << 8) ^ crc24_table[n]);
+    if (pending != 0) {
+        memset(&lower[pending], 0, 8 - pending);
+        memcpy(&word, lower, 8);
+        hash = Hash_Mix(word ^ HASH_SEED_1, hash);
+        total += pending;
     }
 
-    return hash;
+    hash = Hash_Mix(hash ^ total, HASH_SEED_2);
+    return cast(REBINT, cast(uint32_t, hash ^ (hash >> 32)));
 }
 
 
@@ -24,6 +24,685 @@
 
 #include "sys-core.h"
 
+// Searches look at 16 bytes at a time with SSE2 when the compiler targets an
+// x86 that has it (all x86-64 processors do).  GCC and Clang can also build
+// 32 byte AVX2 versions, which are used if the CPU running the interpreter
+// supports them.  Other platforms use memchr() and byte-at-a-time loops.
+//
+// !!! MSVC could do the same AVX2 and SSSE3 dispatch using __cpuid().
+//
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #define FIND_SSE2
+    #include <emmintrin.h>
+
+    #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        #define FIND_AVX2
+        #include <immintrin.h>
+    #endif
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+
+#if defined(FIND_SSE2)
+
+// Position of the lowest set bit in a (nonzero) mask from a byte comparison.
+//
+inline static REBCNT Lowest_Bit(uint32_t mask) {
+    assert(mask != 0);
+  #if defined(__GNUC__)
+    return __builtin_ctz(mask);
+  #elif defined(_MSC_VER)
+    unsigned long n;
+    _BitScanForward(&n, mask);
+    return n;
+  #else
+    REBCNT n = 0;
+    for (; not (mask & 1); mask >>= 1)
+        ++n;
+    return n;
+  #endif
+}
+
+inline static REBCNT Count_Bits(uint32_t mask) {
+  #if defined(__GNUC__)
+    return __builtin_popcount(mask);
+  #else
+    mask = mask - ((mask >> 1) & 0x55555555);
+    mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+    return (((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+  #endif
+}
+
+static const REBYTE *Scan_Bytes_Sse2(
+    const REBYTE *bp,
+    const REBYTE *end,
+    REBYTE a,
+    REBYTE b,
+    bool high
+){
+    const __m128i va = _mm_set1_epi8(cast(char, a));
+    const __m128i vb = _mm_set1_epi8(cast(char, b));
+
+    for (; end - bp >= 16; bp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, bp));
+        uint32_t mask = _mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))
+        );
+        if (high)
+            mask |= _mm_movemask_epi8(v);  // the top bit of each byte
+        if (mask != 0)
+            return bp + Lowest_Bit(mask);
+    }
+    return bp;
+}
+
+static const REBYTE *Find_Bytes_Sse2(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const REBYTE *pattern,
+    REBSIZ size
+){
+    const __m128i vfirst = _mm_set1_epi8(cast(char, pattern[0]));
+    const __m128i vlast = _mm_set1_epi8(cast(char, pattern[size - 1]));
+
+    for (; end - bp >= 16; bp += 16) {
+        __m128i v1 = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i v2 = _mm_loadu_si128(cast(const __m128i*, bp + size - 1));
+        uint32_t mask = _mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(v1, vfirst), _mm_cmpeq_epi8(v2, vlast)
+        ));
+        for (; mask != 0; mask &= mask - 1) {
+            const REBYTE *cp = bp + Lowest_Bit(mask);
+            if (memcmp(cp + 1, pattern + 1, size - 1) == 0)
+                return cp;
+        }
+    }
+    return bp;
+}
+
+static REBCNT Count_Codepoints_Sse2(const REBYTE **bp, const REBYTE *end)
+{
+    // UTF-8 continuation bytes are 0x80 to 0xBF, which are -128 to -65 when
+    // the bytes are compared as signed.
+    //
+    const __m128i vcont = _mm_set1_epi8(-65);
+
+    REBCNT count = 0;
+    for (; end - *bp >= 16; *bp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, *bp));
+        count += Count_Bits(_mm_movemask_epi8(_mm_cmpgt_epi8(v, vcont)));
+    }
+    return count;
+}
+
+#endif
+
+
+#if defined(FIND_AVX2)
+
+__attribute__((target("avx2")))
+static const REBYTE *Scan_Bytes_Avx2(
+    const REBYTE *bp,
+    const REBYTE *end,
+    REBYTE a,
+    REBYTE b,
+    bool high
+){
+    const __m256i va = _mm256_set1_epi8(cast(char, a));
+    const __m256i vb = _mm256_set1_epi8(cast(char, b));
+
+    for (; end - bp >= 32; bp += 32) {
+        __m256i v = _mm256_loadu_si256(cast(const __m256i*, bp));
+        uint32_t mask = _mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb))
+        );
+        if (high)
+            mask |= _mm256_movemask_epi8(v);
+        if (mask != 0)
+            return bp + Lowest_Bit(mask);
+    }
+    return bp;
+}
+
+__attribute__((target("avx2")))
+static const REBYTE *Find_Bytes_Avx2(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const REBYTE *pattern,
+    REBSIZ size
+){
+    const __m256i vfirst = _mm256_set1_epi8(cast(char, pattern[0]));
+    const __m256i vlast = _mm256_set1_epi8(cast(char, pattern[size - 1]));
+
+    for (; end - bp >= 32; bp += 32) {
+        __m256i v1 = _mm256_loadu_si256(cast(const __m256i*, bp));
+        __m256i v2 = _mm256_loadu_si256(cast(const __m256i*, bp + size - 1));
+        uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(v1, vfirst), _mm256_cmpeq_epi8(v2, vlast)
+        ));
+        for (; mask != 0; mask &= mask - 1) {
+            const REBYTE *cp = bp + Lowest_Bit(mask);
+            if (memcmp(cp + 1, pattern + 1, size - 1) == 0)
+                return cp;
+        }
+    }
+    return bp;
+}
+
+#endif
+
+
+//
+// Find the first byte from `bp` up to `end` that is `a` or `b`, or any byte
+// of 0x80 or higher if `high` is true.  Returns `end` if there's none.
+//
+// Case-insensitive searches pass the upper and lowercase forms of an ASCII
+// character as `a` and `b`.  Asking for the `high` bytes as well means no
+// UTF-8 sequence gets skipped, since the case mapping of some non-ASCII
+// characters can give ASCII ones (e.g. KELVIN SIGN lowercases to "k").
+//
+static const REBYTE *Scan_Bytes(
+    const REBYTE *bp,
+    const REBYTE *end,
+    REBYTE a,
+    REBYTE b,
+    bool high
+){
+    if (a == b and not high) {  // libc's memchr() is usually vectorized
+        const REBYTE *found = cast(const REBYTE*, memchr(bp, a, end - bp));
+        return found ? found : end;
+    }
+
+  #if defined(FIND_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        bp = Scan_Bytes_Avx2(bp, end, a, b, high);
+    else
+        bp = Scan_Bytes_Sse2(bp, end, a, b, high);
+  #elif defined(FIND_SSE2)
+    bp = Scan_Bytes_Sse2(bp, end, a, b, high);
+  #endif
+
+    for (; bp != end; ++bp) {  // whole scan if no SIMD, else the leftovers
+        if (*bp == a or *bp == b or (high and *bp >= 0x80))
+            return bp;
+    }
+    return end;
+}
+
+
+//
+// Find the first position from `bp` up to `end` where the `size` bytes of
+// `pattern` occur.  The bytes up to `end + size - 1` must be readable.
+// Returns `end` if there's no match.
+//
+// The vectorized versions only compare whole patterns where both the first
+// and last bytes match, which filters out most positions for typical text.
+//
+static const REBYTE *Find_Bytes(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const REBYTE *pattern,
+    REBSIZ size
+){
+    assert(size != 0);
+
+    if (size == 1)
+        return Scan_Bytes(bp, end, pattern[0], pattern[0], false);
+
+  #if defined(FIND_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        bp = Find_Bytes_Avx2(bp, end, pattern, size);
+    else
+        bp = Find_Bytes_Sse2(bp, end, pattern, size);
+  #elif defined(FIND_SSE2)
+    bp = Find_Bytes_Sse2(bp, end, pattern, size);
+  #endif
+
+    for (; bp != end; ++bp) {
+        bp = Scan_Bytes(bp, end, pattern[0], pattern[0], false);
+        if (bp == end)
+            break;
+        if (memcmp(bp + 1, pattern + 1, size - 1) == 0)
+            return bp;
+    }
+    return end;
+}
+
+
+//
+// Number of UTF-8 encoded characters from `bp` up to `end`.
+//
+static REBCNT Count_Codepoints(const REBYTE *bp, const REBYTE *end)
+{
+    REBCNT count = 0;
+
+  #if defined(FIND_SSE2)
+    count += Count_Codepoints_Sse2(&bp, end);
+  #endif
+
+    for (; bp != end; ++bp) {
+        if ((*bp & 0xC0) != 0x80)  // not a continuation byte
+            ++count;
+    }
+    return count;
+}
+
+
+// A BITSET! that's used to search many characters is turned into a table of
+// what each byte means, so Check_Bit() isn't called for every character.
+// That's only worth doing after BITSET_LOOKUP_AFTER characters were checked.
+//
+// With SSSE3 or AVX2, the ASCII part of the table is also made into a bitmap
+// indexed by the low 4 bits of a byte, giving a bit for each of the 8 values
+// of the upper bits.  Two shuffles then look up 16 or 32 bytes at a time.
+// (This is often called the "PSHUFB nibble lookup".)
+//
+#define BITSET_LOOKUP_AFTER 32
+
+#define BYTE_NOT_IN_SET 0
+#define BYTE_IN_SET 1
+#define BYTE_STARTS_CHAR 2  // non-ASCII UTF-8, must decode for Check_Bit()
+
+struct Reb_Bitset_Lookup {
+    REBYTE table[256];  // BYTE_XXX for each byte value
+    REBYTE high;  // table[] value of all bytes 0x80 and up, or 2 if mixed
+    REBYTE nibbles[16];  // bit (byte >> 4) of [byte & 0xF], if ASCII in set
+};
+
+static void Init_Bitset_Lookup(
+    struct Reb_Bitset_Lookup *lookup,
+    REBSER *bset,
+    bool uncase,
+    bool utf8  // bytes 0x80 and up are parts of UTF-8 characters, not bytes
+){
+    memset(lookup->nibbles, 0, sizeof(lookup->nibbles));
+
+    REBCNT b;
+    for (b = 0; b < 0x80; ++b) {
+        if (Check_Bit(bset, b, uncase)) {
+            lookup->table[b] = BYTE_IN_SET;
+            lookup->nibbles[b & 0x0F] |= 1 << (b >> 4);
+        }
+        else
+            lookup->table[b] = BYTE_NOT_IN_SET;
+    }
+
+    for (b = 0x80; b < 0x100; ++b) {
+        if (utf8)
+            lookup->table[b] = BYTE_STARTS_CHAR;
+        else if (Check_Bit(bset, b, uncase))
+            lookup->table[b] = BYTE_IN_SET;
+        else
+            lookup->table[b] = BYTE_NOT_IN_SET;
+
+        if (b == 0x80)
+            lookup->high = lookup->table[b];
+        else if (lookup->table[b] != lookup->high)
+            lookup->high = BYTE_STARTS_CHAR;
+    }
+}
+
+#if defined(FIND_AVX2)  // SSSE3 dispatch is only done where AVX2 is
+
+__attribute__((target("ssse3")))
+static const REBYTE *Scan_Bitset_Ssse3(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const struct Reb_Bitset_Lookup *lookup,
+    REBYTE skip
+){
+    const __m128i nibbles = _mm_loadu_si128(
+        cast(const __m128i*, lookup->nibbles)
+    );
+    const __m128i rows = _mm_setr_epi8(  // no bits for 0x80 and up
+        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0
+    );
+    const __m128i low4 = _mm_set1_epi8(0x0F);
+    const uint32_t high_stop = (lookup->high == skip) ? 0 : 0xFFFF;
+
+    for (; end - bp >= 16; bp += 16) {
+        __m128i v = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i bits = _mm_and_si128(
+            _mm_shuffle_epi8(nibbles, _mm_and_si128(v, low4)),
+            _mm_shuffle_epi8(rows, _mm_and_si128(_mm_srli_epi16(v, 4), low4))
+        );
+        uint32_t out = _mm_movemask_epi8(
+            _mm_cmpeq_epi8(bits, _mm_setzero_si128())
+        );
+        uint32_t high = _mm_movemask_epi8(v);
+
+        uint32_t stop = (skip == BYTE_IN_SET)
+            ? (out & ~high)
+            : (~out & 0xFFFF);
+        stop |= high & high_stop;
+        if (stop != 0)
+            return bp + Lowest_Bit(stop);
+    }
+    return bp;
+}
+
+__attribute__((target("avx2")))
+static const REBYTE *Scan_Bitset_Avx2(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const struct Reb_Bitset_Lookup *lookup,
+    REBYTE skip
+){
+    const __m256i nibbles = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(cast(const __m128i*, lookup->nibbles))
+    );
+    const __m256i rows = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0
+    ));
+    const __m256i low4 = _mm256_set1_epi8(0x0F);
+    const uint32_t high_stop = (lookup->high == skip) ? 0 : 0xFFFFFFFF;
+
+    for (; end - bp >= 32; bp += 32) {
+        __m256i v = _mm256_loadu_si256(cast(const __m256i*, bp));
+        __m256i bits = _mm256_and_si256(
+            _mm256_shuffle_epi8(nibbles, _mm256_and_si256(v, low4)),
+            _mm256_shuffle_epi8(
+                rows, _mm256_and_si256(_mm256_srli_epi16(v, 4), low4)
+            )
+        );
+        uint32_t out = _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(bits, _mm256_setzero_si256())
+        );
+        uint32_t high = _mm256_movemask_epi8(v);
+
+        uint32_t stop = (skip == BYTE_IN_SET) ? (out & ~high) : ~out;
+        stop |= high & high_stop;
+        if (stop != 0)
+            return bp + Lowest_Bit(stop);
+    }
+    return bp;
+}
+
+#endif
+
+
+//
+// Find the first byte from `bp` up to `end` whose table[] value in the
+// lookup isn't `skip`, or `end` if there's none.  FIND passes a `skip` of
+// BYTE_NOT_IN_SET, and spanning what's in the set passes BYTE_IN_SET.
+//
+static const REBYTE *Scan_Bitset(
+    const REBYTE *bp,
+    const REBYTE *end,
+    const struct Reb_Bitset_Lookup *lookup,
+    REBYTE skip
+){
+  #if defined(FIND_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        bp = Scan_Bitset_Avx2(bp, end, lookup, skip);
+    else if (__builtin_cpu_supports("ssse3"))
+        bp = Scan_Bitset_Ssse3(bp, end, lookup, skip);
+  #endif
+
+    for (; bp != end; ++bp) {
+        if (lookup->table[*bp] != skip)
+            return bp;
+    }
+    return end;
+}
+
+
+//
+// Spanning or finding over UTF-8 with a lookup stops at non-ASCII bytes, so
+// the character there can be decoded and checked.  If the check says it
+// should be skipped, the search goes on after it.
+//
+static const REBYTE *Scan_Bitset_Utf8(
+    REBCNT *count,  // characters skipped over
+    const REBYTE *bp,
+    const REBYTE *end,
+    REBSER *bset,
+    bool uncase,
+    const struct Reb_Bitset_Lookup *lookup,
+    REBYTE skip
+){
+    *count = 0;
+    while (true) {
+        const REBYTE *found = Scan_Bitset(bp, end, lookup, skip);
+        *count += Count_Codepoints(bp, found);
+        if (found == end or *found < 0x80)
+            return found;
+
+        REBUNI c;
+        bp = Back_Scan_UTF8_Char(&c, found, NULL) + 1;  // string, so valid
+        bool in = Check_Bit(bset, c, uncase);
+        if (in != (skip == BYTE_IN_SET))
+            return found;
+
+        ++(*count);
+    }
+}
+
+
+// UTF-8 is validated 16 bytes at a time with SSSE3 using the method from
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser/Lemire).
+// Each byte is checked along with the three bytes before it: the high and
+// low 4 bits of the previous byte and the high 4 bits of the current one
+// are looked up in three tables, giving bits for which errors the pair of
+// bytes could be.  ANDing those leaves only the errors that all three
+// lookups agree on.  Whether the byte has to be the 3rd or 4th byte of a
+// character is figured from the bytes two and three back.
+//
+// The vectorized check only says which block of 16 bytes has the first
+// error, so the exact position is found by checking from there a character
+// at a time.  That's also how leftover bytes at the end are checked, and how
+// the whole thing is checked on CPUs without SSSE3.
+//
+enum {
+    UTF8_TOO_SHORT = 1 << 0,  // lead not followed by continuation
+    UTF8_TOO_LONG = 1 << 1,  // continuation after ASCII
+    UTF8_OVERLONG_3 = 1 << 2,  // 11100000 100_____
+    UTF8_TOO_LARGE = 1 << 3,  // 11110100 1001____ and higher
+    UTF8_SURROGATE = 1 << 4,  // 11101101 101_____
+    UTF8_OVERLONG_2 = 1 << 5,  // 1100000_ 10______
+    UTF8_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____ and higher
+    UTF8_OVERLONG_4 = 1 << 6,  // 11110000 1000____
+    UTF8_TWO_CONTS = 1 << 7,  // continuation after continuation
+
+    UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS
+};
+
+#if defined(FIND_AVX2)  // SSSE3 dispatch is only done where AVX2 is
+
+static const REBYTE Utf8_Byte_1_High[16] = {
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,  // ASCII
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,  // 1100____
+    UTF8_TOO_SHORT,  // 1101____
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,  // 1110____
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+static const REBYTE Utf8_Byte_1_Low[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,  // 0000
+    UTF8_CARRY | UTF8_OVERLONG_2,  // ____0001
+    UTF8_CARRY,  // ____0010
+    UTF8_CARRY,  // ____0011
+    UTF8_CARRY | UTF8_TOO_LARGE,  // ____0100
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,  // ____0101
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,  // ____1000
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+static const REBYTE Utf8_Byte_2_High[16] = {
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,  // ASCII
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS  // 1000____
+        | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS  // 1001____
+        | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS  // 1010____
+        | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS  // 1011____
+        | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT  // 11__
+};
+
+// Returns the start of the first block of 16 bytes which has an error (or
+// where the character the previous block ended with isn't finished), else
+// where the whole blocks end.  Characters in the blocks before that are
+// added to `count`.
+//
+__attribute__((target("ssse3")))
+static const REBYTE *Check_UTF8_Ssse3(
+    REBCNT *count,
+    const REBYTE *bp,
+    const REBYTE *end
+){
+    const __m128i byte_1_high = _mm_loadu_si128(
+        cast(const __m128i*, Utf8_Byte_1_High)
+    );
+    const __m128i byte_1_low = _mm_loadu_si128(
+        cast(const __m128i*, Utf8_Byte_1_Low)
+    );
+    const __m128i byte_2_high = _mm_loadu_si128(
+        cast(const __m128i*, Utf8_Byte_2_High)
+    );
+    const __m128i low4 = _mm_set1_epi8(0x0F);
+    const __m128i vcont = _mm_set1_epi8(-65);  // see Count_Codepoints_Sse2()
+
+    // Leads in the last 3 bytes of a block need bytes from the next one.
+    // Subtracting these with saturation leaves nonzero bytes for those.
+    //
+    const __m128i max_lead = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        cast(char, 0xF0 - 1), cast(char, 0xE0 - 1), cast(char, 0xC0 - 1)
+    );
+
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+
+    for (; end - bp >= 16; bp += 16) {
+        __m128i input = _mm_loadu_si128(cast(const __m128i*, bp));
+        __m128i error;
+
+        if (_mm_movemask_epi8(input) == 0) {  // all ASCII
+            error = prev_incomplete;
+            prev_incomplete = _mm_setzero_si128();
+        }
+        else {
+            __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+            __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+            __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+            __m128i special = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_shuffle_epi8(
+                        byte_1_high,
+                        _mm_and_si128(_mm_srli_epi16(prev1, 4), low4)
+                    ),
+                    _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, low4))
+                ),
+                _mm_shuffle_epi8(
+                    byte_2_high,
+                    _mm_and_si128(_mm_srli_epi16(input, 4), low4)
+                )
+            );
+
+            // The high bit is set where a 3 or 4 byte lead two or three
+            // bytes back means this has to be a continuation byte.  Where
+            // that's so, TWO_CONTS isn't an error...and where it's not, a
+            // continuation is one.
+            //
+            __m128i must23 = _mm_or_si128(
+                _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))
+            );
+            error = _mm_xor_si128(
+                _mm_and_si128(must23, _mm_set1_epi8(-128)),
+                special
+            );
+            prev_incomplete = _mm_subs_epu8(input, max_lead);
+        }
+
+        uint32_t ok = _mm_movemask_epi8(
+            _mm_cmpeq_epi8(error, _mm_setzero_si128())
+        );
+        if (ok != 0xFFFF)
+            return bp;
+
+        prev_input = input;
+        *count += Count_Bits(_mm_movemask_epi8(_mm_cmpgt_epi8(input, vcont)));
+    }
+    return bp;
+}
+
+#endif
+
+
+//
+//  Check_UTF8: C
+//
+// Returns how many of the `size` bytes at `utf8` are valid UTF-8, so if that
+// is less than `size` then the byte at that offset starts the first invalid
+// or cut off character.  Overlong forms, surrogates, and codepoints past
+// 0x10FFFF are invalid.  The number of codepoints in the valid part is put
+// in `num_codepoints_out` if it's not nullptr.
+//
+REBSIZ Check_UTF8(REBCNT *num_codepoints_out, const REBYTE *utf8, REBSIZ size)
+{
+    const REBYTE *bp = utf8;
+    const REBYTE *end = utf8 + size;
+    REBCNT count = 0;
+
+  #if defined(FIND_AVX2)
+    if (__builtin_cpu_supports("ssse3")) {
+        const REBYTE *stop = Check_UTF8_Ssse3(&count, bp, end);
+
+        // The character which the valid blocks end with may go on past them,
+        // so the checking a character at a time starts at its lead byte.
+        //
+        const REBYTE *cp = stop;
+        while (cp != bp and stop - cp < 3 and (cp[-1] & 0xC0) == 0x80)
+            --cp;
+        if (cp != bp and cp[-1] >= 0xC0) {
+            stop = cp - 1;
+            --count;  // the lead was counted
+        }
+        bp = stop;
+    }
+  #endif
+
+    while (true) {
+        const REBYTE *high = Scan_Bytes(bp, end, 0x80, 0x80, true);
+        count += high - bp;  // all ASCII up to there
+        bp = high;
+        if (bp == end)
+            break;
+
+        REBCNT trail = trailingBytesForUTF8[*bp] + 1;
+        if (
+            cast(REBSIZ, end - bp) < trail
+            or not isLegalUTF8(bp, trail)
+        ){
+            break;
+        }
+        bp += trail;
+        ++count;
+    }
+
+    if (num_codepoints_out)
+        *num_codepoints_out = count;
+    return bp - utf8;
+}
+
 
 //
 //  Compare_Binary_Vals: C
@@ -194,12 +873,25 @@ REBINT Compare_String_Vals(const REBCEL *v1, const REBCEL *v2, bool uncase)
     REBCNT l2  = VAL_LEN_AT(v2);
     REBCNT len = MIN(l1, l2);
 
-    REBINT n = Compare_Uni_Str(
-        VAL_STRING_AT(v1),  // as a REBYTE* (can't put REBCHR(*) in %sys-core.h)
-        VAL_STRING_AT(v2),
-        len,
-        uncase
-    );
+    REBINT n;
+    if (
+        Is_Definitely_Ascii(VAL_STRING(v1))
+        and Is_Definitely_Ascii(VAL_STRING(v2))
+    ){
+        n = Compare_Bytes(  // codepoints are bytes, no decoding needed
+            VAL_STRING_AT(v1),
+            VAL_STRING_AT(v2),
+            len,
+            uncase
+        );
+    }
+    else
+        n = Compare_Uni_Str(
+            VAL_STRING_AT(v1),  // REBYTE* (can't put REBCHR(*) in sys-core.h)
+            VAL_STRING_AT(v2),
+            len,
+            uncase
+        );
 
     if (n != 0)
         return n;
@@ -280,27 +972,17 @@ REBCNT Find_Bin_In_Bin(
     if (size2 == 0 || (size2 + offset) > BIN_LEN(series))
         return NOT_FOUND; // pattern empty or is longer than the target
 
-    REBYTE *bp1 = BIN_AT(series, offset);
+    const REBYTE *bp1 = BIN_AT(series, offset);
     REBCNT size1 = BIN_LEN(series) - offset;
 
-    REBYTE *end1 = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
+    const REBYTE *end1
+        = bp1 + ((flags & AM_FIND_MATCH) ? 1 : size1 - (size2 - 1));
 
-    REBYTE b2 = *bp2; // first byte
+    const REBYTE *found = Find_Bytes(bp1, end1, bp2, size2);
+    if (found == end1)
+        return NOT_FOUND;
 
-    while (bp1 != end1) {
-        if (*bp1 == b2) { // matched first byte
-            REBCNT n;
-            for (n = 1; n < size2; n++) {
-                if (bp1[n] != bp2[n])
-                    break;
-            }
-            if (n == size2)
-                return bp1 - BIN_HEAD(series);
-        }
-        ++bp1;
-    }
-
-    return NOT_FOUND;
+    return found - BIN_HEAD(series);
 }
 
 
@@ -354,7 +1036,20 @@ REBCNT Find_Str_In_Bin(
     next2 = NEXT_CHR(&c2_canon, next2);
     c2_canon = LO_CASE(c2_canon);
 
+    // If the first character is ASCII, then only its upper and lowercase
+    // forms (or non-ASCII bytes, see Scan_Bytes()) can start a match.
+    //
+    bool scan = (*bp2 < 0x80);
+    REBYTE lower = cast(REBYTE, LO_CASE(*bp2));
+    REBYTE upper = cast(REBYTE, UP_CASE(*bp2));
+
     while (bp1 < end1) {
+        if (scan) {
+            bp1 = Scan_Bytes(bp1, end1, lower, upper, true);
+            if (bp1 == end1)
+                break;
+        }
+
         const REBYTE *next1;
         REBUNI c1;
         if (*bp1 < 0x80) {
@@ -403,26 +1098,145 @@ REBCNT Find_Str_In_Bin(
 
 
 //
-//  Find_Str_In_Str: C
-//
-// General purpose find a substring.
+// Forward search with a skip of 1 for the UTF-8 of `len` characters at `bp2`
+// in the characters of `str` from `index` up to (but not including) `end`.
 //
-// Supports: forward/reverse with skip, cased/uncase.
+// Matching is done on the bytes, then the characters skipped over are
+// counted to get the index.  UTF-8 encodes each character one way, so for a
+// case-sensitive search it's enough to compare the bytes.
 //
-// Skip can be set positive or negative (for reverse).
+static REBCNT Find_Utf8_Forward(
+    REBSTR *str,
+    REBCNT index,
+    REBCNT end,
+    const REBYTE *bp2,
+    REBCNT len,
+    bool uncase
+){
+    assert(index < end);
+
+    bool ascii = Is_Definitely_Ascii(str);  // then index is just the offset
+
+    const REBYTE *bp1 = cast(const REBYTE*, STR_AT(str, index));
+    const REBYTE *tail = cast(const REBYTE*, STR_TAIL(str));
+    const REBYTE *end1 = end >= STR_LEN(str)
+        ? tail
+        : cast(const REBYTE*, STR_AT(str, end));
+
+    if (not uncase) {
+        const REBYTE *tp2 = bp2;
+        REBCNT n;
+        for (n = 0; n < len; ++n) {
+            do {
+                ++tp2;
+            } while ((*tp2 & 0xC0) == 0x80);
+        }
+        REBSIZ size2 = tp2 - bp2;
+
+        if (cast(REBSIZ, tail - bp1) < size2)
+            return NOT_FOUND;
+        if (end1 > tail - (size2 - 1))
+            end1 = tail - (size2 - 1);  // rest of input too short to match
+
+        const REBYTE *found = Find_Bytes(bp1, end1, bp2, size2);
+        if (found == end1)
+            return NOT_FOUND;
+        if (ascii)
+            return index + (found - bp1);
+        return index + Count_Codepoints(bp1, found);
+    }
+
+    REBYTE lower = cast(REBYTE, LO_CASE(*bp2));
+    REBYTE upper = cast(REBYTE, UP_CASE(*bp2));
+
+    while (true) {
+        const REBYTE *found = Scan_Bytes(bp1, end1, lower, upper, true);
+        if (ascii)
+            index += found - bp1;
+        else
+            index += Count_Codepoints(bp1, found);
+        if (found == end1)
+            return NOT_FOUND;
+
+        REBCHR(const*) tp1 = cast(REBCHR(const*), found);
+        REBCHR(const*) tp2 = cast(REBCHR(const*), bp2);
+        REBCNT n;
+        for (n = 0; n < len; n++) {
+            REBUNI c1;
+            tp1 = NEXT_CHR(&c1, tp1);
+
+            REBUNI c2;
+            tp2 = NEXT_CHR(&c2, tp2);
+            if (c1 != c2 and LO_CASE(c1) != LO_CASE(c2))
+                break;
+        }
+        if (n == len)
+            return index;
+
+        bp1 = found;
+        do {
+            ++bp1;
+        } while ((*bp1 & 0xC0) == 0x80);
+        ++index;
+    }
+}
+
+
 //
-// Flags are set according to ALL_FIND_REFS
+// The body of Find_Str_In_Str(), for the UTF-8 of `len` characters at `bp2`.
 //
-REBCNT Find_Str_In_Str(
+static REBCNT Find_Utf8_In_Str(
     REBSTR *str1,
     REBCNT index_unsigned,
     REBCNT end_unsigned,
     REBINT skip,
-    REBSTR *str2,
-    REBINT index2,
+    const REBYTE *bp2,
     REBCNT len,
     REBFLGS flags
 ){
+    assert((flags & ~(AM_FIND_CASE | AM_FIND_MATCH)) == 0);
+
+    bool uncase = not (flags & AM_FIND_CASE); // case insenstive
+
+    // Plain forward searches can use vectorized scanning for the first
+    // character, as long as a case-insensitive one starts with ASCII.
+    //
+    if (
+        skip == 1
+        and len != 0
+        and not (flags & AM_FIND_MATCH)
+        and not (uncase and *bp2 >= 0x80)
+    ){
+        if (index_unsigned >= end_unsigned)
+            return NOT_FOUND;
+        return Find_Utf8_Forward(
+            str1, index_unsigned, end_unsigned, bp2, len, uncase
+        );
+    }
+
+    // In an all-ASCII string the index of a character is its offset, so an
+    // ASCII pattern can be compared byte-for-byte at each position visited.
+    // This is the common case for FIND/MATCH (e.g. PARSE matching TEXT!).
+    //
+    if (
+        len != 0
+        and Is_Definitely_Ascii(str1)
+        and All_Bytes_ASCII(m_cast(REBYTE*, bp2), len)
+    ){
+        const REBYTE *head = BIN_HEAD(SER(str1));
+
+        REBINT i = index_unsigned;
+        REBINT end = end_unsigned;
+        REBINT start = (skip < 0) ? 0 : i;
+        for (; skip < 0 ? i >= start : i < end; i += skip) {
+            if (Compare_Bytes(head + i, bp2, len, uncase) == 0)  // stops at 0
+                return i;
+            if (flags & AM_FIND_MATCH)
+                break;
+        }
+        return NOT_FOUND;
+    }
+
     // Signed quantities used to allow stepping outside of bounds and still
     // being able to compare, but incoming parameters should not be negative.
     //
@@ -435,12 +1249,8 @@ REBCNT Find_Str_In_Str(
     else
         start = index;
 
-    assert((flags & ~(AM_FIND_CASE | AM_FIND_MATCH)) == 0);
-
-    bool uncase = not (flags & AM_FIND_CASE); // case insenstive
-
     REBUNI c2_canon; // calculate first char lowercase once, vs. each step
-    REBCHR(const*) next2 = STR_AT(str2, index2);
+    REBCHR(const*) next2 = cast(REBCHR(const*), bp2);
     next2 = NEXT_CHR(&c2_canon, next2);
     if (uncase)
         c2_canon = LO_CASE(c2_canon);
@@ -486,6 +1296,39 @@ REBCNT Find_Str_In_Str(
 }
 
 
+//
+//  Find_Str_In_Str: C
+//
+// General purpose find a substring.
+//
+// Supports: forward/reverse with skip, cased/uncase.
+//
+// Skip can be set positive or negative (for reverse).
+//
+// Flags are set according to ALL_FIND_REFS
+//
+REBCNT Find_Str_In_Str(
+    REBSTR *str1,
+    REBCNT index_unsigned,
+    REBCNT end_unsigned,
+    REBINT skip,
+    REBSTR *str2,
+    REBINT index2,
+    REBCNT len,
+    REBFLGS flags
+){
+    return Find_Utf8_In_Str(
+        str1,
+        index_unsigned,
+        end_unsigned,
+        skip,
+        cast(const REBYTE*, STR_AT(str2, index2)),
+        len,
+        flags
+    );
+}
+
+
 //
 //  Find_Char_In_Str: C
 //
@@ -508,24 +1351,22 @@ REBCNT Find_Char_In_Str(
 ){
     assert((flags & ~(AM_FIND_CASE | AM_FIND_MATCH)) == 0);
 
-    // !!! In UTF-8, finding a char in a string is really just like finding a
-    // string in a string.  Optimize as this all folds together.
-
-    REBSTR *temp = Make_Codepoint_String(uni);
+    // In UTF-8, finding a char in a string is really just like finding a
+    // string in a string.  The character is encoded here to search for, vs.
+    // making a series for it.
+    //
+    REBYTE encoded[8];
+    encoded[Encode_UTF8_Char(encoded, uni)] = '\0';
 
-    REBCNT i = Find_Str_In_Str(
+    return Find_Utf8_In_Str(
         s,
         index_orig,
         highest,
         skip,
-        temp,
-        0,
+        encoded,
         1,
         flags
     );
-    Free_Unmanaged_Series(SER(temp));
-
-    return i;
 }
 
 
@@ -543,9 +1384,6 @@ REBCNT Find_Char_In_Bin(
 ){
     assert((flags & ~(AM_FIND_CASE | AM_FIND_MATCH)) == 0);
 
-    // !!! In UTF-8, finding a char in a string is really just like finding a
-    // string in a string.  Optimize as this all folds together.
-
     if (skip != 1)
         fail ("Find_Char_In_Bin() does not support SKIP <> 1 at the moment");
 
@@ -554,20 +1392,17 @@ REBCNT Find_Char_In_Bin(
 
     UNUSED(lowest);
 
-    REBSTR *temp = Make_Codepoint_String(uni);
+    REBYTE encoded[8];  // see notes in Find_Char_In_Str()
+    REBSIZ size = Encode_UTF8_Char(encoded, uni);
 
-    REBCNT i = Find_Str_In_Bin(
+    return Find_Str_In_Bin(
         bin,
         index_orig,
-        STR_HEAD(temp),
+        encoded,
         1, // 1 character
-        STR_SIZE(temp),
+        size,
         flags
     );
-
-    Free_Unmanaged_Series(SER(temp));
-
-    return i;
 }
 
 
@@ -597,6 +1432,7 @@ REBCNT Find_Bin_Bitset(
 
     REBYTE *bp1 = BIN_AT(bin, offset);
 
+    REBINT checks = 0;
     while (skip < 0 ? offset >= head : offset < tail) {
         const bool uncase = false;
         if (Check_Bit(bset, *bp1, uncase))
@@ -605,6 +1441,18 @@ REBCNT Find_Bin_Bitset(
         if (flags & AM_FIND_MATCH)
             break;
 
+        if (skip == 1 and ++checks == BITSET_LOOKUP_AFTER) {
+            struct Reb_Bitset_Lookup lookup;
+            Init_Bitset_Lookup(&lookup, bset, uncase, false);
+
+            const REBYTE *found = Scan_Bitset(
+                bp1 + 1, BIN_AT(bin, tail), &lookup, BYTE_NOT_IN_SET
+            );
+            if (found == BIN_AT(bin, tail))
+                return NOT_FOUND;
+            return found - BIN_HEAD(bin);
+        }
+
         bp1 += skip;
         offset += skip;
     }
@@ -652,6 +1500,7 @@ REBCNT Find_Str_Bitset(
     else
         cp1 = BACK_CHR(&c1, cp1);
 
+    REBINT checks = 0;
     while (skip < 0 ? index >= start : index < end) {
         if (Check_Bit(bset, c1, uncase))
             return index;
@@ -659,6 +1508,32 @@ REBCNT Find_Str_Bitset(
         if (flags & AM_FIND_MATCH)
             break;
 
+        if (skip == 1 and ++checks == BITSET_LOOKUP_AFTER) {
+            if (index + 1 >= end)
+                break;
+
+            struct Reb_Bitset_Lookup lookup;
+            Init_Bitset_Lookup(&lookup, bset, uncase, true);
+
+            const REBYTE *end1 = end >= cast(REBINT, STR_LEN(str))
+                ? cast(const REBYTE*, STR_TAIL(str))
+                : cast(const REBYTE*, STR_AT(str, end));
+
+            REBCNT count;
+            const REBYTE *found = Scan_Bitset_Utf8(
+                &count,
+                cast(const REBYTE*, cp1),  // cp1 is already after index
+                end1,
+                bset,
+                uncase,
+                &lookup,
+                BYTE_NOT_IN_SET
+            );
+            if (found == end1)
+                return NOT_FOUND;
+            return index + 1 + count;
+        }
+
         cp1 = SKIP_CHR(&c1, cp1, skip);
         index += skip;
     }
@@ -667,6 +1542,88 @@ REBCNT Find_Str_Bitset(
 }
 
 
+//
+//  Span_Bin_Bitset: C
+//
+// Number of bytes from `offset` (up to `limit` of them) which are in the
+// bitset, as PARSE checks with Check_Bit().  Used so that `some bitset` and
+// similar rules don't have to take one byte per iteration.
+//
+REBCNT Span_Bin_Bitset(
+    REBSER *bin,
+    REBCNT offset,
+    REBCNT limit,
+    REBSER *bset,
+    bool uncase
+){
+    const REBYTE *bp = BIN_AT(bin, offset);
+    const REBYTE *end = BIN_TAIL(bin);
+    if (cast(REBCNT, end - bp) > limit)
+        end = bp + limit;
+
+    REBCNT n = 0;
+    for (; bp + n != end; ++n) {
+        if (not Check_Bit(bset, bp[n], uncase))
+            return n;
+
+        if (n == BITSET_LOOKUP_AFTER) {
+            struct Reb_Bitset_Lookup lookup;
+            Init_Bitset_Lookup(&lookup, bset, uncase, false);
+            return Scan_Bitset(bp + n, end, &lookup, BYTE_IN_SET) - bp;
+        }
+    }
+    return n;
+}
+
+
+//
+//  Span_Str_Bitset: C
+//
+// Number of characters from `index` (up to `limit` of them) which are in
+// the bitset.  See Span_Bin_Bitset().
+//
+REBCNT Span_Str_Bitset(
+    REBSTR *str,
+    REBCNT index,
+    REBCNT limit,
+    REBSER *bset,
+    bool uncase
+){
+    REBCHR(const*) cp = STR_AT(str, index);
+    REBCNT len = STR_LEN(str);
+    if (len - index < limit)
+        limit = len - index;
+
+    REBCNT n = 0;
+    for (; n != limit; ++n) {
+        REBUNI c;
+        REBCHR(const*) next = NEXT_CHR(&c, cp);
+        if (not Check_Bit(bset, c, uncase))
+            return n;
+
+        if (n == BITSET_LOOKUP_AFTER) {
+            struct Reb_Bitset_Lookup lookup;
+            Init_Bitset_Lookup(&lookup, bset, uncase, true);
+
+            REBCNT count;
+            Scan_Bitset_Utf8(
+                &count,
+                cast(const REBYTE*, cp),
+                cast(const REBYTE*, STR_TAIL(str)),
+                bset,
+                uncase,
+                &lookup,
+                BYTE_IN_SET
+            );
+            return MIN(n + count, limit);
+        }
+
+        cp = next;
+    }
+    return n;
+}
+
+
 //
 //  Count_Lines: C
 //
@@ -747,3 +1704,295 @@ REBCNT Find_In_Any_Sequence(
 
     fail ("Unknown sequence type for Find_In_Any_Sequence()");
 }
+
+
+//
+//  Make_Searcher: C
+//
+// Build an Aho-Corasick automaton for the TEXT! and BINARY! patterns in the
+// cells from `head` to an END.  BAR!s are skipped, so the alternates of a
+// PARSE rule like `["a" | "b"]` can be given.  Patterns are numbered from 0.
+// With `uncase`, the characters of the patterns are lowercased (only ASCII
+// letters for BINARY!), and input is lowercased the same way as it's read.
+//
+// Which byte comes next is looked up by its "class", with all the bytes that
+// aren't in any pattern sharing class 0.  Failure links are folded into the
+// table of transitions, so searching is one lookup per byte.
+//
+struct Reb_Searcher *Make_Searcher(
+    const RELVAL *head,
+    REBSPC *specifier,
+    bool uncase
+){
+    REBCNT num_patterns = 0;
+    REBSIZ max_size = 0;  // lowercasing can change the size of characters
+    bool whole_chars = true;
+
+    const RELVAL *item;
+    for (item = head; NOT_END(item); ++item) {
+        if (IS_WORD(item) and VAL_WORD_SYM(item) == SYM_BAR)
+            continue;
+        if (not IS_TEXT(item) and not IS_BINARY(item))
+            fail (Error_Bad_Value_Core(item, specifier));
+
+        REBSIZ size;
+        const REBYTE *bp = VAL_BYTES_AT(&size, item);
+        if (size == 0)
+            fail ("Patterns to search for can't be empty");
+        if (IS_BINARY(item) and Check_UTF8(nullptr, bp, size) != size)
+            whole_chars = false;
+
+        max_size += IS_TEXT(item) ? size * 4 : size;
+        ++num_patterns;
+    }
+    if (num_patterns == 0)
+        fail ("No patterns given to search for");
+
+    REBYTE *bytes = ALLOC_N(REBYTE, max_size);
+    REBSIZ *offsets = ALLOC_N(REBSIZ, num_patterns + 1);
+
+    REBSIZ total = 0;
+    REBCNT n = 0;
+    for (item = head; NOT_END(item); ++item) {
+        if (IS_WORD(item) and VAL_WORD_SYM(item) == SYM_BAR)
+            continue;
+
+        offsets[n++] = total;
+
+        REBSIZ size;
+        const REBYTE *bp = VAL_BYTES_AT(&size, item);
+        const REBYTE *ep = bp + size;
+        for (; bp != ep; ++bp) {
+            if (not uncase)
+                bytes[total++] = *bp;
+            else if (*bp < 0x80)
+                bytes[total++] = cast(REBYTE, LO_CASE(*bp));
+            else if (IS_BINARY(item))
+                bytes[total++] = *bp;
+            else {
+                REBUNI c;
+                bp = Back_Scan_UTF8_Char(&c, bp, NULL);
+                total += Encode_UTF8_Char(bytes + total, LO_CASE(c));
+            }
+        }
+    }
+    offsets[n] = total;
+
+    struct Reb_Searcher *s = ALLOC(struct Reb_Searcher);
+    s->uncase = uncase;
+    s->whole_chars = whole_chars;
+    s->num_patterns = num_patterns;
+    s->sizes = ALLOC_N(REBSIZ, num_patterns);
+    s->lens = ALLOC_N(REBCNT, num_patterns);
+    for (n = 0; n < num_patterns; ++n) {
+        s->sizes[n] = offsets[n + 1] - offsets[n];
+        s->lens[n] = Count_Codepoints(
+            bytes + offsets[n], bytes + offsets[n + 1]
+        );
+    }
+
+    REBSIZ i;
+    for (i = 0; i < 256; ++i)
+        s->classes[i] = 0;
+    s->num_classes = 1;
+    for (i = 0; i < total; ++i) {
+        if (s->classes[bytes[i]] == 0)
+            s->classes[bytes[i]] = s->num_classes++;
+    }
+
+    const REBCNT C = s->num_classes;  // width of a row of transitions
+
+    // Make the trie of the patterns.  Since state 0 is the root, it can't be
+    // the target of a trie edge, so 0 means "no edge" while building.
+    //
+    s->max_states = total + 1;
+    s->next = ALLOC_N_ZEROFILL(REBCNT, s->max_states * C);
+    s->depth = ALLOC_N(REBCNT, s->max_states);
+    s->output = ALLOC_N(REBINT, s->max_states);
+    s->dict = ALLOC_N(REBCNT, s->max_states);
+
+    s->depth[0] = 0;
+    s->output[0] = -1;
+    s->dict[0] = 0;
+
+    REBCNT num_states = 1;
+    for (n = 0; n < num_patterns; ++n) {
+        REBCNT state = 0;
+        for (i = offsets[n]; i < offsets[n + 1]; ++i) {
+            REBCNT *edge = &s->next[state * C + s->classes[bytes[i]]];
+            if (*edge == 0) {
+                *edge = num_states++;
+                s->depth[*edge] = s->depth[state] + 1;
+                s->output[*edge] = -1;
+            }
+            state = *edge;
+        }
+        if (s->output[state] < 0)  // first of any duplicate patterns wins
+            s->output[state] = n;
+    }
+
+    // Breadth-first, fill in the failure transitions of each state from the
+    // row of the state its failure link goes to (which is shallower, so its
+    // row is already done).  Rows only have their trie edges until then.
+    //
+    REBCNT *fail_links = ALLOC_N(REBCNT, s->max_states);
+    REBCNT *queue = ALLOC_N(REBCNT, s->max_states);
+    REBCNT q_head = 0;
+    REBCNT q_tail = 0;
+
+    fail_links[0] = 0;
+    queue[q_tail++] = 0;
+    while (q_head != q_tail) {
+        REBCNT state = queue[q_head++];
+        REBCNT *row = &s->next[state * C];
+        const REBCNT *fail_row = &s->next[fail_links[state] * C];
+
+        REBCNT c;
+        for (c = 0; c < C; ++c) {
+            REBCNT to = row[c];
+            if (to == 0) {
+                row[c] = (state == 0) ? 0 : fail_row[c];
+                continue;
+            }
+
+            REBCNT link = (state == 0) ? 0 : fail_row[c];
+            fail_links[to] = link;
+            s->dict[to] = (s->output[link] >= 0) ? link : s->dict[link];
+            queue[q_tail++] = to;
+        }
+    }
+    assert(q_tail == num_states);
+
+    FREE_N(REBCNT, s->max_states, queue);
+    FREE_N(REBCNT, s->max_states, fail_links);
+    FREE_N(REBSIZ, num_patterns + 1, offsets);
+    FREE_N(REBYTE, max_size, bytes);
+
+    return s;
+}
+
+
+//
+//  Free_Searcher: C
+//
+void Free_Searcher(struct Reb_Searcher *s)
+{
+    FREE_N(REBCNT, s->max_states, s->dict);
+    FREE_N(REBINT, s->max_states, s->output);
+    FREE_N(REBCNT, s->max_states, s->depth);
+    FREE_N(REBCNT, s->max_states * s->num_classes, s->next);
+    FREE_N(REBCNT, s->num_patterns, s->lens);
+    FREE_N(REBSIZ, s->num_patterns, s->sizes);
+    FREE(struct Reb_Searcher, s);
+}
+
+
+//
+//  Find_With_Searcher: C
+//
+// Find where the first match of any of a searcher's patterns starts in the
+// series, between `index` and `end`.  If several start there, the pattern
+// numbered lowest is the one matched (like PARSE alternates).  For strings
+// the indices and length are in codepoints, and for binaries in bytes.
+// Strings can only be searched if the patterns are `whole_chars`, since a
+// BINARY! pattern that isn't valid UTF-8 could match inside a character.
+//
+// Returns NOT_FOUND if no pattern occurs.
+//
+REBCNT Find_With_Searcher(
+    REBCNT *len,  // length of the match
+    REBCNT *which,  // number of the pattern matched
+    const struct Reb_Searcher *s,
+    REBSER *series,
+    REBCNT index,
+    REBCNT end,
+    bool utf8  // series is a string
+){
+    const REBYTE *bp;
+    const REBYTE *ep;
+    if (utf8) {
+        assert(s->whole_chars);
+        REBSTR *str = STR(series);
+        bp = cast(const REBYTE*, STR_AT(str, index));
+        ep = end >= STR_LEN(str)
+            ? cast(const REBYTE*, STR_TAIL(str))
+            : cast(const REBYTE*, STR_AT(str, end));
+    }
+    else {
+        bp = BIN_AT(series, index);
+        ep = BIN_AT(series, end);
+    }
+
+    const REBCNT C = s->num_classes;
+
+    // As the automaton is given bytes, matches are found in the order of
+    // where they end.  Positions are compared by counting the bytes it was
+    // given (`fed`), as lowercasing can change the size of characters.  Once
+    // no partial match started at or before the best one, it's the answer.
+    //
+    REBCNT state = 0;
+    REBSIZ fed = 0;
+    REBCNT units = index;  // codepoints (or bytes) read so far
+
+    REBINT best = -1;
+    REBSIZ best_fed = 0;
+    REBCNT best_index = 0;
+
+    while (bp != ep) {
+        if (*bp < 0x80) {
+            REBYTE b = s->uncase ? cast(REBYTE, LO_CASE(*bp)) : *bp;
+            state = s->next[state * C + s->classes[b]];
+            ++fed;
+            ++bp;
+        }
+        else if (not utf8) {
+            state = s->next[state * C + s->classes[*bp]];
+            ++fed;
+            ++bp;
+        }
+        else if (not s->uncase) {
+            do {
+                state = s->next[state * C + s->classes[*bp]];
+                ++fed;
+                ++bp;
+            } while (bp != ep and (*bp & 0xC0) == 0x80);
+        }
+        else {
+            REBUNI c;
+            bp = Back_Scan_UTF8_Char(&c, bp, NULL) + 1;  // string, so valid
+
+            REBYTE encoded[8];
+            REBSIZ size = Encode_UTF8_Char(encoded, LO_CASE(c));
+            REBSIZ i;
+            for (i = 0; i < size; ++i)
+                state = s->next[state * C + s->classes[encoded[i]]];
+            fed += size;
+        }
+        ++units;
+
+        REBCNT t = (s->output[state] >= 0) ? state : s->dict[state];
+        for (; t != 0; t = s->dict[t]) {
+            REBINT p = s->output[t];
+            REBSIZ start = fed - s->sizes[p];
+            if (
+                best < 0
+                or start < best_fed
+                or (start == best_fed and p < best)
+            ){
+                best = p;
+                best_fed = start;
+                best_index = units - (utf8 ? s->lens[p] : s->sizes[p]);
+            }
+        }
+
+        if (best >= 0 and fed - s->depth[state] > best_fed)
+            break;
+    }
+
+    if (best < 0)
+        return NOT_FOUND;
+
+    *len = utf8 ? s->lens[best] : s->sizes[best];
+    *which = best;
+    return best_index;
+}
@@ -314,68 +314,50 @@ REBSTR *Append_UTF8_May_Fail(
     // * It's needed to know how many characters (length) are in the series,
     //   not just how many bytes.  The higher level concept of "length" gets
     //   stored in the series MISC() field.
-    // * In the future, some operations will be accelerated by knowing that
-    //   a string only contains ASCII codepoints.
+    //
+    // Check_UTF8() validates and counts the characters in one pass (16 bytes
+    // at a time on most x86 CPUs).  After that, the bytes can be copied as
+    // they are, except for any CR that is being taken out.
 
     const REBYTE *bp = cb_cast(utf8);
+    const REBYTE *end = bp + size;
 
-    DECLARE_MOLD (mo); // !!! REVIEW: don't need intermediate if no crlf_to_lf
-    Push_Mold(mo);
-
-    bool all_ascii = true;
-    REBCNT num_codepoints = 0;
-
-    REBSIZ bytes_left = size; // see remarks on Back_Scan_UTF8_Char's 3rd arg
-    for (; bytes_left > 0; --bytes_left, ++bp) {
-        REBUNI c = *bp;
-        if (c >= 0x80) {
-            bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-            if (bp == NULL)
-                fail (Error_Bad_Utf8_Raw()); // !!! Should Back_Scan() fail?
-
-            all_ascii = false;
-        }
-        else if (c == CR && crlf_to_lf) {
-            if (bp[1] == LF)
-                continue; // skip the CR, do the decrement and get the LF
-            c = LF;
-        }
-
-        ++num_codepoints;
-        Append_Codepoint(mo->series, c);
-    }
-
-    UNUSED(all_ascii);
-
-    // !!! The implicit nature of this is probably not the best way of
-    // handling things, but... if the series we were supposed to be appending
-    // to was the mold buffer, that's what we just did.  Consider making this
-    // a specific call for Mold_Utf8() or similar.
-    //
-    if (dst == mo->series)
-        return dst;
+    REBCNT num_codepoints;
+    if (Check_UTF8(&num_codepoints, bp, size) != size)
+        fail (Error_Bad_Utf8_Raw());
 
     if (not dst)
-        return Pop_Molded_String(mo);
+        dst = Make_String(size);
 
     REBCNT old_len = STR_LEN(dst);
     REBSIZ old_size = STR_SIZE(dst);
 
     EXPAND_SERIES_TAIL(SER(dst), size);
-    memcpy(
-        BIN_AT(SER(dst), old_size),
-        BIN_AT(SER(mo->series), mo->offset),
-        STR_SIZE(mo->series) - mo->offset
-    );
+    REBYTE *dp = BIN_AT(SER(dst), old_size);
+
+    const REBYTE *cr = crlf_to_lf
+        ? cast(const REBYTE*, memchr(bp, CR, size))
+        : nullptr;
+
+    for (; cr; cr = cast(const REBYTE*, memchr(bp, CR, end - bp))) {
+        memcpy(dp, bp, cr - bp);
+        dp += cr - bp;
+        bp = cr + 1;
+
+        if (bp != end and *bp == LF)
+            --num_codepoints;  // drop the CR, the LF gets copied next
+        else
+            *dp++ = LF;
+    }
+    memcpy(dp, bp, end - bp);
+    dp += end - bp;
 
     TERM_STR_LEN_SIZE(
         dst,
         old_len + num_codepoints,
-        old_size + STR_SIZE(mo->series) - mo->offset
+        dp - BIN_HEAD(SER(dst))
     );
 
-    Drop_Mold(mo);
-
     return dst;
 }
 
@@ -294,6 +294,17 @@ void Change_Case(
 
     REBCNT len = Part_Len_May_Modify_Index(val, part);
 
+    if (Is_Definitely_Ascii(VAL_STRING(val))) {  // bytes are the codepoints
+        REBYTE *bp = cast(REBYTE*, VAL_STRING_AT(val));
+        REBYTE from = upper ? 'a' : 'A';
+        REBCNT n;
+        for (n = 0; n < len; ++n) {
+            if (cast(REBYTE, bp[n] - from) < 26)  // letter of the other case
+                bp[n] ^= 0x20;
+        }
+        return;
+    }
+
     // !!! This assumes that all case changes will preserve the encoding size,
     // but that's not true (some strange multibyte accented characters have
     // capital or lowercase versions that are single byte).  This may be
@@ -399,3 +410,168 @@ REBARR *Split_Lines(const REBVAL *str)
 
     return Pop_Stack_Values_Core(dsp_orig, ARRAY_FLAG_NEWLINE_AT_TAIL);
 }
+
+
+//
+//  Find_Bookmarked_Offset: C
+//
+// Gives the byte offset of the codepoint at `at` in a string, scanning from
+// whichever of its head, tail, or bookmarks is closest.  This is the slow
+// path of STR_AT(), so it makes the bookmarks if there weren't any, and it
+// moves the last access bookmark to the position found.  If that position
+// was STR_BOOKMARK_SPAN or more codepoints from the nearest bookmark, it is
+// also added to the index.  (See notes in %sys-string.h)
+//
+REBSIZ Find_Bookmarked_Offset(REBSTR *s, REBCNT at)
+{
+    assert(not IS_STR_SYMBOL(s));
+
+    REBCNT len = STR_LEN(s);
+    assert(at <= len);
+
+    REBBMK *bookmarks = LINK(s).bookmarks;
+    if (not bookmarks)
+        LINK(s).bookmarks = bookmarks = Alloc_Bookmarks();
+
+    // Binary search the index (cells after the last access) for the first
+    // bookmark past `at`.  That's also where a new one for `at` would go.
+    //
+    REBCNT above = 1;
+    REBCNT hi = ARR_LEN(bookmarks);
+    while (above < hi) {
+        REBCNT mid = above + (hi - above) / 2;
+        if (BMK_INDEX(bookmarks, mid) <= at)
+            above = mid + 1;
+        else
+            hi = mid;
+    }
+
+    REBCNT index;  // where the scan starts, head or tail unless beaten
+    REBSIZ offset;
+    if (at < len - at) {
+        index = 0;
+        offset = 0;
+    }
+    else {
+        index = len;
+        offset = STR_SIZE(s);
+    }
+    REBCNT distance = (index > at) ? index - at : at - index;
+
+    REBCNT candidates[3];
+    REBCNT num_candidates = 0;
+    candidates[num_candidates++] = 0;  // last access
+    if (above > 1)
+        candidates[num_candidates++] = above - 1;  // nearest at or before
+    if (above < ARR_LEN(bookmarks))
+        candidates[num_candidates++] = above;  // nearest after
+
+    REBCNT i;
+    for (i = 0; i < num_candidates; ++i) {
+        REBCNT booked = BMK_INDEX(bookmarks, candidates[i]);
+        REBCNT d = (booked > at) ? booked - at : at - booked;
+        if (d < distance) {
+            distance = d;
+            index = booked;
+            offset = BMK_OFFSET(bookmarks, candidates[i]);
+        }
+    }
+
+    REBCHR(*) cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + offset);
+    for (; index < at; ++index)
+        cp = NEXT_STR(cp);
+    for (; index > at; --index)
+        cp = BACK_STR(cp);
+    offset = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+
+    if (distance >= STR_BOOKMARK_SPAN) {  // too far from the others, index it
+        Expand_Series(SER(bookmarks), above, 1);
+        Init_Bookmark(ARR_AT(bookmarks, above), at, offset);
+    }
+
+    BMK_INDEX(bookmarks, 0) = at;
+    BMK_OFFSET(bookmarks, 0) = offset;
+    return offset;
+}
+
+
+//
+//  Update_Bookmarks: C
+//
+// Patch a string's bookmarks after the `removed` codepoints at `index` were
+// replaced by `added` codepoints, changing its size by `size_delta` bytes.
+// Bookmarks up to `index` are still good, those inside the replaced part are
+// dropped, and those after it are shifted.
+//
+void Update_Bookmarks(
+    REBSTR *s,
+    REBCNT index,
+    REBCNT removed,
+    REBCNT added,
+    REBINT size_delta
+){
+    REBBMK *bookmarks = LINK(s).bookmarks;
+    if (not bookmarks)
+        return;
+
+    REBCNT dest = 1;  // index entries are compacted as they're patched
+    REBCNT n;
+    for (n = 0; n < ARR_LEN(bookmarks); ++n) {
+        REBCNT booked = BMK_INDEX(bookmarks, n);
+        REBSIZ offset = BMK_OFFSET(bookmarks, n);
+
+        if (booked <= index) {
+            // before the change, still good
+        }
+        else if (booked < index + removed) {  // in replaced part, no good
+            if (n == 0) {  // the last access can't just be dropped...
+                BMK_INDEX(bookmarks, 0) = 0;  // ...so move it to the head
+                BMK_OFFSET(bookmarks, 0) = 0;
+            }
+            continue;
+        }
+        else {
+            booked = booked - removed + added;
+            offset = cast(REBSIZ, cast(REBINT, offset) + size_delta);
+        }
+
+        if (n == 0) {
+            BMK_INDEX(bookmarks, 0) = booked;
+            BMK_OFFSET(bookmarks, 0) = offset;
+            continue;
+        }
+
+        if (dest > 1 and BMK_INDEX(bookmarks, dest - 1) == booked)
+            continue;  // removal shifted it onto the one before it
+
+        BMK_INDEX(bookmarks, dest) = booked;
+        BMK_OFFSET(bookmarks, dest) = offset;
+        ++dest;
+    }
+
+    TERM_ARRAY_LEN(bookmarks, dest);
+}
+
+
+//
+//  Trim_Bookmarks: C
+//
+// Drop bookmarks past `index` in a string, e.g. because it was truncated or
+// because the content after that index was rewritten in place.
+//
+void Trim_Bookmarks(REBSTR *s, REBCNT index)
+{
+    REBBMK *bookmarks = LINK(s).bookmarks;
+    if (not bookmarks)
+        return;
+
+    if (BMK_INDEX(bookmarks, 0) > index) {  // last access moves to the head
+        BMK_INDEX(bookmarks, 0) = 0;
+        BMK_OFFSET(bookmarks, 0) = 0;
+    }
+
+    REBCNT len = ARR_LEN(bookmarks);
+    while (len > 1 and BMK_INDEX(bookmarks, len - 1) > index)
+        --len;  // the index entries are sorted, so just chop off the tail
+    TERM_ARRAY_LEN(bookmarks, len);
+}
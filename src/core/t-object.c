@@ -323,7 +323,7 @@ REB_R MAKE_Context(
         // !!! This binds the actual body data, not a copy of it.  See
         // Virtual_Bind_Deep_To_New_Context() for future directions.
         //
-        Bind_Values_Deep(VAL_ARRAY_AT(arg), ctx);
+        Bind_Values_Deep(VAL_ARRAY(arg), VAL_INDEX(arg), ctx);
 
         DECLARE_LOCAL (dummy);
         if (Do_Any_Array_At_Throws(dummy, arg, SPECIFIED)) {
@@ -409,9 +409,7 @@ REB_R PD_Context(
     if (not IS_WORD(picker))
         return R_UNHANDLED;
 
-    const bool always = false;
-    REBCNT n = Find_Canon_In_Context(c, VAL_WORD_CANON(picker), always);
-
+    REBCNT n = Find_Canon_In_Context_Cached(c, VAL_WORD_CANON(picker));
     if (n == 0)
         return R_UNHANDLED;
 
@@ -488,10 +486,11 @@ REBNATIVE(set_meta)
 
     REBVAL *v = ARG(value);
 
-    if (IS_ACTION(v))
-        MISC_META_NODE(VAL_ACT_PARAMLIST(v)) = NOD(meta);
-    else
-        MISC_META_NODE(VAL_CONTEXT(v)) = NOD(meta);
+    REBSER *s = IS_ACTION(v)
+        ? SER(VAL_ACT_PARAMLIST(v))
+        : SER(CTX_VARLIST(VAL_CONTEXT(v)));
+    Remember_Series(s);  // may be old, and meta may be young
+    MISC_META_NODE(s) = NOD(meta);
 
     if (not meta)
         return nullptr;
@@ -892,7 +891,8 @@ REBNATIVE(construct)
             D_OUT,
             Construct_Context_Managed(
                 REB_OBJECT,
-                VAL_ARRAY_AT(spec),
+                VAL_ARRAY(spec),
+                VAL_INDEX(spec),
                 VAL_SPECIFIER(spec),
                 parent
             )
@@ -913,7 +913,7 @@ REBNATIVE(construct)
     // !!! This binds the actual body data, not a copy of it.  See
     // Virtual_Bind_Deep_To_New_Context() for future directions.
     //
-    Bind_Values_Deep(VAL_ARRAY_AT(spec), context);
+    Bind_Values_Deep(VAL_ARRAY(spec), VAL_INDEX(spec), context);
 
     DECLARE_LOCAL (dummy);
     if (Do_Any_Array_At_Throws(dummy, spec, SPECIFIED)) {
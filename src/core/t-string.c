@@ -83,7 +83,7 @@ static void swap_chars(REBVAL *val1, REBVAL *val2)
 
 static void reverse_binary(REBVAL *v, REBCNT len)
 {
-    REBYTE *bp = VAL_BIN_AT(v);
+    REBYTE *bp = VAL_RAW_DATA_AT(v);  // also used on all-ASCII strings
 
     REBCNT n = 0;
     REBCNT m = len - 1;
@@ -174,67 +174,39 @@ REBCNT find_string(
     assert(end >= index);
 
     if (ANY_STRING(pattern)) {
-        bool str_is_all_ascii = false;
-        bool pattern_is_all_ascii = false;
-        if (str_is_all_ascii and not pattern_is_all_ascii)
-            return NOT_FOUND; // can't possibly find non-ascii in ascii
-
+        //
         // !!! A TAG! does not have its delimiters in it.  The logic of the
         // find would have to be rewritten to accomodate this, and it's a
         // bit tricky as it is.  Let it settle down before trying that--and
         // for now just form the tag into a temporary alternate series.
 
         REBSTR *formed = nullptr;
-        REBYTE *bp2;
         REBSIZ size2;
         if (not IS_TEXT(pattern)) { // !!! for TAG!, but what about FILE! etc?
             formed = Copy_Form_Value(pattern, 0);
             *len = STR_LEN(formed);
-            bp2 = STR_HEAD(formed);
             size2 = STR_SIZE(formed);
         }
         else {
             *len = VAL_LEN_AT(pattern);
-            bp2 = VAL_STRING_AT(pattern);
             size2 = VAL_SIZE_LIMIT_AT(NULL, pattern, *len);
         }
 
         REBCNT result;
 
         if (
-            str_is_all_ascii
-            and skip == 1  // optimizations not written for skips
+            (flags & AM_FIND_CASE)
+            and Is_Definitely_Ascii(str)
+            and size2 != *len  // pattern has some multi-byte codepoints
         ){
-            if (*len > end - index)  // series not long enough for pattern
-                return NOT_FOUND;
-
-            assert(pattern_is_all_ascii);  // checked above
-
-            // If one knew that the series being searched in was all ASCII,
-            // then the same search code can be used as for binary...because
-            // the binary offset can be used as a character position.
-
-            if (flags & AM_FIND_CASE)
-                result = Find_Bin_In_Bin(
-                    SER(str),  // all_ascii can be treated same as binary
-                    index,
-                    bp2,
-                    size2,
-                    flags & AM_FIND_MATCH
-                );
-            else
-                return Find_Str_In_Bin(
-                    SER(str),  // all_ascii can be treated same as binary
-                    index,
-                    bp2,
-                    *len,
-                    size2,
-                    flags & AM_FIND_MATCH
-                );
+            result = NOT_FOUND;  // can't possibly find non-ascii in ascii
         }
-        else
+        else {
+            // If the series being searched in is all ASCII, Find_Str_In_Str()
+            // will use the byte offsets as the character positions.
+            //
             result = Find_Str_In_Str(
-                str,  // not all_ascii, has multibyte utf-8 sequences
+                str,
                 index,
                 end,
                 skip,
@@ -243,6 +215,7 @@ REBCNT find_string(
                 *len,
                 flags & (AM_FIND_MATCH | AM_FIND_CASE)
             );
+        }
 
         if (formed)
             Free_Unmanaged_Series(SER(formed));
@@ -740,6 +713,15 @@ void Mold_Uni_Char(REB_MOLD *mo, REBUNI c, bool parened)
 }
 
 
+// Whether Mold_Uni_Char() appends a byte of an all-ASCII string as-is.
+//
+inline static bool Is_Plain_Ascii_For_Mold(REBYTE b, bool parened) {
+    if (b == 0x7F)
+        return not parened;
+    return b != 0x1E and not IS_CHR_ESC(b);
+}
+
+
 //
 //  Mold_Text_Series_At: C
 //
@@ -769,7 +751,7 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBCNT index) {
     REBCHR(const*) up = STR_AT(s, index);
 
     REBCNT x;
-    for (x = index; x < len; x++) {
+    for (x = 0; x < len; x++) {
         REBUNI c;
         up = NEXT_CHR(&c, up);
 
@@ -814,16 +796,35 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBCNT index) {
 
     up = STR_AT(s, index);
 
+    // All-ASCII strings are emitted in runs of the bytes that don't need any
+    // escaping, instead of a codepoint at a time.
+    //
+    bool ascii = Is_Definitely_Ascii(s);
+    const REBYTE *tail = BIN_TAIL(SER(s));
+
     // If it is a short quoted string, emit it as "string"
     //
     if (len <= MAX_QUOTED_STR && quote == 0 && newline < 3) {
         Append_Codepoint(buf, '"');
 
-        REBCNT n;
-        for (n = index; n < STR_LEN(s); n++) {
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            Mold_Uni_Char(mo, c, parened);
+        if (ascii) {
+            const REBYTE *bp = cast(const REBYTE*, up);
+            while (bp != tail) {
+                const REBYTE *run = bp;
+                while (bp != tail and Is_Plain_Ascii_For_Mold(*bp, parened))
+                    ++bp;
+                Append_Ascii_Len(buf, cast(const char*, run), bp - run);
+                if (bp != tail)
+                    Mold_Uni_Char(mo, *bp++, parened);
+            }
+        }
+        else {
+            REBCNT n;
+            for (n = index; n < STR_LEN(s); n++) {
+                REBUNI c;
+                up = NEXT_CHR(&c, up);
+                Mold_Uni_Char(mo, c, parened);
+            }
         }
 
         Append_Codepoint(buf, '"');
@@ -836,6 +837,39 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBCNT index) {
 
     Append_Codepoint(buf, '{');
 
+    if (ascii) {  // braces (if aligned), newlines, and quotes are as-is too
+        const REBYTE *bp = cast(const REBYTE*, up);
+        while (bp != tail) {
+            const REBYTE *run = bp;
+            for (; bp != tail; ++bp) {
+                if (*bp == '{' or *bp == '}') {
+                    if (malign)
+                        break;
+                }
+                else if (
+                    *bp != '\n' and *bp != '"'
+                    and not Is_Plain_Ascii_For_Mold(*bp, parened)
+                ){
+                    break;
+                }
+            }
+            Append_Ascii_Len(buf, cast(const char*, run), bp - run);
+            if (bp == tail)
+                break;
+
+            if (*bp == '{' or *bp == '}') {  // same as the switch below
+                Append_Codepoint(buf, '^');
+                Append_Codepoint(buf, *bp);
+            }
+            else
+                Mold_Uni_Char(mo, *bp, parened);
+            ++bp;
+        }
+
+        Append_Codepoint(buf, '}');
+        return;
+    }
+
     REBCNT n;
     for (n = index; n < STR_LEN(s); n++) {
         REBUNI c;
@@ -844,10 +878,8 @@ void Mold_Text_Series_At(REB_MOLD *mo, REBSTR *s, REBCNT index) {
         switch (c) {
         case '{':
         case '}':
-            if (malign) {
+            if (malign)
                 Append_Codepoint(buf, '^');
-                break;
-            }
             // fall through
         case '\n':
         case '"':
@@ -1017,9 +1049,13 @@ REBTYPE(String)
         REBSIZ size_old = STR_SIZE(s);
 
         Remove_Series_Units(SER(s), offset, size);  // should keep terminator
-        Free_Bookmarks_Maybe_Null(s);
+        Update_Bookmarks(s, index, len, 0, - cast(REBINT, size));
         SET_STR_LEN_SIZE(s, tail - len, size_old - size);  // no term needed
 
+      #if defined(DEBUG_BOOKMARKS_ON_MODIFY)
+        Check_Bookmarks_Debug(s);
+      #endif
+
         RETURN (v); }
 
     //-- Modification:
@@ -1184,11 +1220,9 @@ REBTYPE(String)
         if (index == 0 and IS_SER_DYNAMIC(s))
             Unbias_Series(SER(s), false);
 
-        Free_Bookmarks_Maybe_Null(s);  // review!
         REBSIZ offset = VAL_OFFSET_FOR_INDEX(v, index);
-        Free_Bookmarks_Maybe_Null(s);
 
-        TERM_STR_LEN_SIZE(s, cast(REBCNT, index), offset);
+        TERM_STR_LEN_SIZE(s, cast(REBCNT, index), offset);  // trims bookmarks
         RETURN (v); }
 
     //-- Creation:
@@ -102,7 +102,19 @@
 #define P_COLLECTION \
     (IS_BLANK(P_COLLECTION_VALUE) ? nullptr : VAL_ARRAY(P_COLLECTION_VALUE))
 
-#define P_NUM_QUOTES_VALUE  (f->rootvar + 4)
+#define P_MEMO_VALUE        (f->rootvar + 4)
+#define P_MEMO \
+    (IS_BLANK(P_MEMO_VALUE) \
+        ? nullptr \
+        : VAL_HANDLE_POINTER(struct Reb_Parse_Memo, P_MEMO_VALUE))
+
+#define P_STREAM_VALUE      (f->rootvar + 5)
+#define P_STREAM \
+    (IS_BLANK(P_STREAM_VALUE) \
+        ? nullptr \
+        : VAL_HANDLE_POINTER(struct Reb_Parse_Stream, P_STREAM_VALUE))
+
+#define P_NUM_QUOTES_VALUE  (f->rootvar + 6)
 #define P_NUM_QUOTES        VAL_INT32(P_NUM_QUOTES_VALUE)
 
 #define P_OUT (f->out)
@@ -144,6 +156,304 @@ inline static bool IS_BAR(const RELVAL *v)
     }
 
 
+// An array's program can be in any of the PARSE_PROGRAM_CACHE_WAYS slots
+// starting at this one.
+//
+#define PARSE_PROGRAM_SET(a) \
+    (&TG_Parse_Programs[ \
+        ((cast(uintptr_t, (a)) >> 4) * PARSE_PROGRAM_CACHE_WAYS) \
+            & (PARSE_PROGRAM_CACHE_SIZE - 1) \
+    ])
+
+static void Free_Parse_Program(struct Reb_Parse_Program *program)
+{
+    if (program->searchers[0])
+        Free_Searcher(program->searchers[0]);
+    if (program->searchers[1])
+        Free_Searcher(program->searchers[1]);
+    FREE_N(REBCNT, program->len + 1, program->alternates);
+    FREE_N(REBYTE, (program->len + 1) * PARSE_FIRST_SIZE, program->firsts);
+    program->rules = nullptr;
+}
+
+
+//
+//  Forget_Parse_Program: C
+//
+// Called by Decay_Series() on arrays, so a program isn't used by another
+// array which is later allocated at the same address.
+//
+void Forget_Parse_Program(REBARR *a)
+{
+    struct Reb_Parse_Program *set = PARSE_PROGRAM_SET(a);
+    REBCNT n;
+    for (n = 0; n < PARSE_PROGRAM_CACHE_WAYS; ++n) {
+        if (set[n].rules == a) {
+            Free_Parse_Program(&set[n]);
+            return;
+        }
+    }
+}
+
+
+#define SET_PARSE_FIRST(first,n) \
+    ((first)[(n) >> 3] |= (1 << ((n) & 7)))
+
+#define GET_PARSE_FIRST(first,n) \
+    ((first)[(n) >> 3] & (1 << ((n) & 7)))
+
+// A few non-ASCII codepoints fold to ASCII letters when case is ignored (e.g.
+// KELVIN SIGN U+212A lowercases to "k"), so an ASCII letter rule could match
+// non-ASCII input, and a non-ASCII rule could match an ASCII letter.
+//
+static void Add_Parse_First_Letters(REBYTE *first)
+{
+    REBCNT n;
+    for (n = 'A'; n <= 'Z'; ++n) {
+        SET_PARSE_FIRST(first, n);
+        SET_PARSE_FIRST(first, n - 'A' + 'a');
+    }
+}
+
+static void Add_Parse_First(REBYTE *first, REBUNI c)
+{
+    if (c < 0x80) {  // either case may match if not PARSE/CASE
+        SET_PARSE_FIRST(first, c);
+        SET_PARSE_FIRST(first, UP_CASE(c));
+        SET_PARSE_FIRST(first, LO_CASE(c));
+        if (UP_CASE(c) != LO_CASE(c))  // a letter, see above
+            SET_PARSE_FIRST(first, PARSE_FIRST_NON_ASCII);
+        return;
+    }
+
+    // Case-insensitive matches of non-ASCII codepoints may have other lead
+    // bytes when encoded, so just say any non-ASCII input may start them.
+    //
+    REBCNT n;
+    for (n = 0x80; n <= PARSE_FIRST_NON_ASCII; ++n)
+        SET_PARSE_FIRST(first, n);
+
+    if (UP_CASE(c) < 0x80)
+        Add_Parse_First(first, UP_CASE(c));
+    if (LO_CASE(c) < 0x80)
+        Add_Parse_First(first, LO_CASE(c));
+}
+
+
+// Figure out which bytes of a BINARY! (or ASCII characters of a string) the
+// sequence of rules starting at `cell` might match.  Only rules which must
+// match something at the current position are looked at.  Anything else
+// (a keyword, a word, a group, an empty string...) could match anything.
+//
+static void Init_Parse_First(REBYTE *first, const RELVAL *cell)
+{
+    memset(first, 0, PARSE_FIRST_SIZE);
+
+    switch (IS_END(cell) ? REB_0_END : KIND_BYTE(cell)) {
+      case REB_TEXT:
+        if (VAL_LEN_AT(cell) == 0)
+            break;
+        Add_Parse_First(first, GET_CHAR_AT(VAL_STRING(cell), VAL_INDEX(cell)));
+        return;
+
+      case REB_CHAR:
+        Add_Parse_First(first, VAL_CHAR(cell));
+        return;
+
+      case REB_BINARY:
+        if (VAL_LEN_AT(cell) == 0)
+            break;
+        Add_Parse_First(first, *VAL_BIN_AT(cell));
+        return;
+
+      case REB_BITSET: {
+        REBSER *bset = VAL_BITSET(cell);
+        REBCNT n;
+        for (n = 0; n < 0x100; ++n) {
+            if (Check_Bit(bset, n, true))
+                SET_PARSE_FIRST(first, n);
+        }
+        if (BITS_NOT(bset) or SER_LEN(bset) > 0x80 / 8) {
+            SET_PARSE_FIRST(first, PARSE_FIRST_NON_ASCII);
+            Add_Parse_First_Letters(first);  // member may fold to ASCII
+        }
+        else {
+            for (n = 'A'; n <= 'Z'; ++n) {
+                if (GET_PARSE_FIRST(first, n)) {  // may match a non-ASCII fold
+                    SET_PARSE_FIRST(first, PARSE_FIRST_NON_ASCII);
+                    break;
+                }
+            }
+        }
+        return; }
+
+      default:
+        break;
+    }
+
+    memset(first, 0xFF, PARSE_FIRST_SIZE);
+}
+
+
+// Get the program for a rule array, making it if the array is frozen and
+// doesn't have one yet.  The program it replaces is an empty one in the
+// array's set if there is one, else the one gotten least recently.
+//
+static struct Reb_Parse_Program *Get_Parse_Program(REBARR *rules)
+{
+    struct Reb_Parse_Program *set = PARSE_PROGRAM_SET(rules);
+    struct Reb_Parse_Program *program = &set[0];
+
+    REBCNT n;
+    for (n = 0; n < PARSE_PROGRAM_CACHE_WAYS; ++n) {
+        if (set[n].rules == rules) {
+            set[n].used = ++TG_Parse_Program_Tick;
+            return &set[n];
+        }
+        if (not program->rules)
+            continue;  // already found an empty one
+        if (not set[n].rules or set[n].used < program->used)
+            program = &set[n];
+    }
+
+    if (not Is_Array_Deeply_Frozen(rules))
+        return nullptr;
+
+    if (program->rules)
+        Free_Parse_Program(program);
+
+    REBCNT len = ARR_LEN(rules);
+    program->alternates = ALLOC_N(REBCNT, len + 1);
+    program->alternates[len] = len;
+
+    n = len;
+    while (n-- != 0) {
+        if (IS_BAR(ARR_AT(rules, n)))
+            program->alternates[n] = n;
+        else
+            program->alternates[n] = program->alternates[n + 1];
+    }
+
+    program->firsts = ALLOC_N(REBYTE, (len + 1) * PARSE_FIRST_SIZE);
+    for (n = 0; n <= len; ++n)
+        Init_Parse_First(
+            program->firsts + (n * PARSE_FIRST_SIZE),
+            ARR_AT(rules, n)
+        );
+
+    program->searchers[0] = nullptr;
+    program->searchers[1] = nullptr;
+
+    program->rules = rules;
+    program->used = ++TG_Parse_Program_Tick;
+    program->len = len;
+    return program;
+}
+
+
+// The program is only used if the feed is on the array's cells, and gives
+// back the index of the current rule.
+//
+static struct Reb_Parse_Program *Get_Feed_Parse_Program(
+    REBCNT *index,
+    REBFRM *f
+){
+    struct Reb_Feed *feed = f->feed;
+    if (IS_END(feed->value) or feed->vaptr or not feed->array)
+        return nullptr;
+
+    *index = feed->index - 1;  // feed->index is the *next* position
+    if (feed->value != ARR_AT(feed->array, *index))
+        return nullptr;
+
+    return Get_Parse_Program(feed->array);
+}
+
+
+// Move the rule feed forward to the cell at `index`, which may be the tail.
+//
+static void Seek_Rule_Index(REBFRM *f, REBCNT index)
+{
+    struct Reb_Feed *feed = f->feed;
+    if (feed->index == index + 1)
+        return;  // already there
+
+    // Reposition to the cell just before, and let the fetch take care of
+    // what it does when reaching the end of an array (e.g. release holds).
+    //
+    assert(index >= feed->index);
+    feed->value = ARR_AT(feed->array, index - 1);
+    feed->pending = feed->value + 1;
+    feed->index = index;
+    FETCH_NEXT_RULE(f);
+}
+
+
+// Skipping to the next alternate on a failed match is frequent, and can walk
+// over many cells if the alternates are long.  If the rules have a program,
+// this jumps right to the `|` (or the end).
+//
+static void Fetch_To_Bar_Or_End(REBFRM *f)
+{
+    REBCNT index;
+    struct Reb_Parse_Program *program = Get_Feed_Parse_Program(&index, f);
+    if (program)
+        Seek_Rule_Index(f, program->alternates[index]);
+    else
+        FETCH_TO_BAR_OR_END(f);
+}
+
+
+// When starting an alternate on BINARY! or string input, skip over it (and
+// the ones after it) if its first rule can't match the next character.  This
+// returns false if none of the alternates could match.
+//
+static bool Did_Seek_Possible_Alternate(REBFRM *f)
+{
+    REBCNT index;
+    struct Reb_Parse_Program *program = Get_Feed_Parse_Program(&index, f);
+    if (not program or P_POS >= SER_LEN(P_INPUT))
+        return true;
+
+    REBCNT key;
+    if (P_TYPE == REB_BINARY)
+        key = *BIN_AT(P_INPUT, P_POS);
+    else if (ANY_STRING_KIND(P_TYPE)) {
+        REBUNI c = GET_CHAR_AT(STR(P_INPUT), P_POS);
+        key = c < 0x80 ? c : PARSE_FIRST_NON_ASCII;
+    }
+    else
+        return true;  // arrays don't use FIRST sets
+
+    REBCNT start = index;
+    while (not GET_PARSE_FIRST(
+        program->firsts + (index * PARSE_FIRST_SIZE),
+        key
+    )){
+        index = program->alternates[index];
+        if (index == program->len)
+            return false;
+        ++index;  // skip the `|`
+    }
+
+    if (index != start)
+        Seek_Rule_Index(f, index);
+    return true;
+}
+
+
+//
+//  Shutdown_Parse: C
+//
+void Shutdown_Parse(void)
+{
+    REBCNT n;
+    for (n = 0; n < PARSE_PROGRAM_CACHE_SIZE; ++n) {
+        if (TG_Parse_Programs[n].rules)
+            Free_Parse_Program(&TG_Parse_Programs[n]);
+    }
+}
+
 // See the notes on `flags` in the main parse loop for how these work.
 //
 // !!! Review if all the parse state flags can be merged into the frame
@@ -181,6 +491,433 @@ inline static REBSYM VAL_CMD(const RELVAL *v) {
 }
 
 
+// PARSE/MEMO remembers what happened when a rule BLOCK! was tried at an
+// input position, so backtracking into it again at that position doesn't
+// run it again.  This makes grammars that backtrack a lot run in linear
+// time, but it means that the rules are treated as if they have no side
+// effects: a GROUP! or a SET in a block won't run when its result is reused.
+// (Rules aren't remembered while a COLLECT is in effect, and the memo is
+// cleared when PARSE changes the input with REMOVE, INSERT, or CHANGE.)
+//
+// The table lives in an unmanaged series, so if a fail() happens it's freed
+// along with any other manual series.  It's kept in a struct on the C stack
+// of PARSE which SUBPARSE frames reach through a HANDLE!, so that growing
+// the table doesn't need to update the frames.
+//
+// Entries are keyed by the addresses of the rule array, its specifier and
+// the input.  So those are held in the managed, GC-guarded `held` array
+// until the PARSE is over: otherwise a GROUP! could drop the last reference
+// to one, and a new series made at its address would get its results.
+//
+struct Reb_Parse_Memo_Entry {
+    REBARR *rules;  // nullptr if entry is unused
+    REBSPC *specifier;
+    REBSER *input;
+    REBCNT index;  // index of the rules in the BLOCK!
+    REBCNT pos;  // position in input that the rules were tried at
+    REBCNT result;  // position after the match, or NOT_FOUND
+};
+
+struct Reb_Parse_Memo {
+    REBSER *table;  // power of 2 number of Reb_Parse_Memo_Entry
+    REBARR *held;  // rule blocks and inputs of the entries, see above
+    REBARR *last_rules;  // last ones added to `held`, to not add them again
+    REBSER *last_input;
+    REBCNT count;
+    REBCNT generation;  // bumped by Clear_Parse_Memo()
+};
+
+#define PARSE_MEMO_MIN_SIZE 256
+
+static void Init_Parse_Memo_Table(struct Reb_Parse_Memo *memo, REBCNT size)
+{
+    memo->table = Make_Series(size, sizeof(struct Reb_Parse_Memo_Entry));
+    SET_SERIES_LEN(memo->table, size);
+    memset(
+        SER_DATA_RAW(memo->table),
+        0,
+        size * sizeof(struct Reb_Parse_Memo_Entry)
+    );
+    memo->count = 0;
+}
+
+static struct Reb_Parse_Memo_Entry *Find_Parse_Memo(
+    struct Reb_Parse_Memo *memo,
+    REBARR *rules,
+    REBCNT index,
+    REBSPC *specifier,
+    REBSER *input,
+    REBCNT pos
+){
+    uintptr_t hash = cast(uintptr_t, rules) >> 4;
+    hash = (hash * 31) + index;
+    hash = (hash * 31) + (cast(uintptr_t, input) >> 4);
+    hash = (hash * 31) + pos;
+    hash ^= cast(uintptr_t, specifier) >> 4;
+    hash ^= hash >> 15;
+
+    REBCNT mask = SER_LEN(memo->table) - 1;
+    struct Reb_Parse_Memo_Entry *entries
+        = SER_HEAD(struct Reb_Parse_Memo_Entry, memo->table);
+
+    REBCNT n = hash & mask;
+    while (true) {
+        struct Reb_Parse_Memo_Entry *e = &entries[n];
+        if (
+            not e->rules or (
+                e->rules == rules and e->index == index and e->pos == pos
+                and e->input == input and e->specifier == specifier
+            )
+        ){
+            return e;
+        }
+        n = (n + 1) & mask;
+    }
+}
+
+// A rule block was tried, so remember what happened.
+//
+static void Memoize_Parse_Result(
+    REBFRM *f,
+    const RELVAL *rule,
+    REBCNT pos,
+    REBIXO i
+){
+    struct Reb_Parse_Memo *memo = P_MEMO;
+
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo(
+        memo, VAL_ARRAY(rule), VAL_INDEX(rule), P_RULE_SPECIFIER, P_INPUT, pos
+    );
+    if (not e->rules) {
+        e->rules = VAL_ARRAY(rule);
+        e->specifier = P_RULE_SPECIFIER;
+        e->input = P_INPUT;
+        e->index = VAL_INDEX(rule);
+        e->pos = pos;
+        ++memo->count;
+
+        if (e->rules != memo->last_rules) {  // BLOCK! holds specifier too
+            Derelativize(Alloc_Tail_Array(memo->held), rule, e->specifier);
+            memo->last_rules = e->rules;
+        }
+        if (e->input != memo->last_input) {
+            Move_Value(Alloc_Tail_Array(memo->held), P_INPUT_VALUE);
+            memo->last_input = e->input;
+        }
+    }
+    e->result = (i == END_FLAG) ? NOT_FOUND : i;
+
+    if (memo->count * 2 < SER_LEN(memo->table))
+        return;
+
+    // Table is half full, double its size.
+    //
+    REBSER *old = memo->table;
+    REBCNT old_size = SER_LEN(old);
+    Init_Parse_Memo_Table(memo, old_size * 2);
+
+    struct Reb_Parse_Memo_Entry *old_e
+        = SER_HEAD(struct Reb_Parse_Memo_Entry, old);
+    REBCNT n;
+    for (n = 0; n < old_size; ++n, ++old_e) {
+        if (not old_e->rules)
+            continue;
+        *Find_Parse_Memo(
+            memo,
+            old_e->rules,
+            old_e->index,
+            old_e->specifier,
+            old_e->input,
+            old_e->pos
+        ) = *old_e;
+        ++memo->count;
+    }
+    Free_Unmanaged_Series(old);
+}
+
+// If the rule block was tried at this position before, give back the result.
+//
+static bool Did_Find_Parse_Memo(REBIXO *i, REBFRM *f, const RELVAL *rule)
+{
+    struct Reb_Parse_Memo *memo = P_MEMO;
+    if (not memo or P_COLLECTION)
+        return false;
+
+    struct Reb_Parse_Memo_Entry *e = Find_Parse_Memo(
+        memo,
+        VAL_ARRAY(rule),
+        VAL_INDEX(rule),
+        P_RULE_SPECIFIER,
+        P_INPUT,
+        P_POS
+    );
+    if (not e->rules)
+        return false;
+
+    *i = (e->result == NOT_FOUND) ? END_FLAG : e->result;
+    return true;
+}
+
+static void Clear_Parse_Memo(struct Reb_Parse_Memo *memo)
+{
+    memset(
+        SER_DATA_RAW(memo->table),
+        0,
+        SER_LEN(memo->table) * sizeof(struct Reb_Parse_Memo_Entry)
+    );
+    memo->count = 0;
+    ++memo->generation;  // see Memoize_Parse_Result() callers
+
+    TERM_ARRAY_LEN(memo->held, 0);
+    memo->last_rules = nullptr;
+    memo->last_input = nullptr;
+}
+
+
+// PARSE of a PORT! reads from the port in chunks into a BINARY!, which is
+// the input the SUBPARSE frames see.  Before each match by any SUBPARSE of
+// the buffer, it is filled to at least PARSE_STREAM_CHUNK bytes past the
+// parse position (or to the end of the port's data).  Input before the
+// lowest position that any of those SUBPARSEs may still go back to is then
+// dropped, and the positions they hold are moved down to match.  TO and THRU
+// read further as they search, see To_Thru_Stream_Rule().
+//
+// A rule with an alternate left to try keeps all the input since the
+// alternate's start, so e.g. `[some chunk | other]` holds everything SOME
+// matches in memory.  But positions saved in variables by marks don't keep
+// input.  Seeking one whose input was dropped is an error, which is why the
+// kept input goes into a new BINARY! each time (see Parse_Stream_Index()).
+//
+struct Reb_Parse_Level {
+    struct Reb_Parse_Level *prior;  // SUBPARSE this one was called from
+    REBFRM *frame;
+    REBCNT *start;  // the SUBPARSE's own positions, set once it's running
+    REBCNT *begin;
+    REBCNT keep;  // lowest position it needs, NOT_FOUND if none
+};
+
+struct Reb_Parse_Stream {
+    REBVAL *port;
+    REBVAL *buffer_value;  // GC-guarded, holds `buffer`
+    REBBIN *buffer;
+    REBARR *retired;  // GC-guarded, [binary base end ...] of former buffers
+    bool eof;
+    REBI64 dropped;  // total bytes dropped, so the port offset of `buffer`
+    struct Reb_Parse_Level *top;  // SUBPARSE of the buffer running now
+};
+
+#define PARSE_STREAM_CHUNK (64 * 1024)
+
+// The port is read with READ/PART, so this only works for ports that do that
+// synchronously (like files).  Network ports read asynchronously, and fail
+// on READ/PART.
+//
+static void Read_Parse_Stream(struct Reb_Parse_Stream *stream)
+{
+    REBVAL *chunk = rebValue(
+        "read/part", stream->port, rebI(PARSE_STREAM_CHUNK),
+    rebEND);
+
+    if (chunk and IS_BINARY(chunk) and VAL_LEN_AT(chunk) != 0)
+        Append_Series(stream->buffer, VAL_BIN_AT(chunk), VAL_LEN_AT(chunk));
+    else
+        stream->eof = true;
+
+    if (chunk)
+        rebRelease(chunk);
+}
+
+// A position that isn't needed any more may point into dropped input, and
+// is just moved to the head.
+//
+static void Drop_Parse_Position(REBCNT *pos, REBI64 dropped)
+{
+    if (*pos == NOT_FOUND)
+        return;
+    *pos = (*pos > dropped) ? cast(REBCNT, *pos - dropped) : 0;
+}
+
+static void Drop_Parse_Level_Input(
+    struct Reb_Parse_Level *level,
+    REBBIN *buffer,
+    REBCNT dropped
+){
+    REBFRM *f = level->frame;
+    INIT_VAL_NODE(P_INPUT_VALUE, buffer);
+    Drop_Parse_Position(&P_POS, dropped);
+    if (level->start) {
+        Drop_Parse_Position(level->start, dropped);
+        Drop_Parse_Position(level->begin, dropped);
+    }
+    if (level->keep != NOT_FOUND)
+        level->keep -= dropped;
+}
+
+// The input from `lowest` on goes into a new BINARY! for the buffer, and the
+// old one is emptied and frozen.  It's listed in `retired` with the range of
+// the port's data it held, as long as some of that range is still kept.
+//
+static void Drop_Parse_Stream_Input(
+    struct Reb_Parse_Stream *stream,
+    REBCNT lowest
+){
+    REBBIN *old = stream->buffer;
+    REBI64 base = stream->dropped;
+    REBI64 end = base + BIN_LEN(old);
+
+    REBBIN *buffer = Make_Binary(0);
+    Swap_Series_Content(old, buffer);  // data moves, it isn't copied
+    Remove_Series_Len(buffer, 0, lowest);
+    Freeze_Sequence(old);  // a stale mark's series can't be changed
+
+    stream->buffer = buffer;
+    Init_Binary(stream->buffer_value, buffer);
+    stream->dropped += lowest;
+
+    RELVAL *src = ARR_HEAD(stream->retired);
+    RELVAL *dest = src;
+    for (; NOT_END(src); src += 3) {
+        if (VAL_INT64(src + 2) <= stream->dropped)
+            continue;  // all of its input is gone
+        if (dest != src) {
+            Blit_Cell(dest, src);
+            Blit_Cell(dest + 1, src + 1);
+            Blit_Cell(dest + 2, src + 2);
+        }
+        dest += 3;
+    }
+    TERM_ARRAY_LEN(stream->retired, dest - ARR_HEAD(stream->retired));
+
+    Init_Binary(Alloc_Tail_Array(stream->retired), old);
+    Init_Integer(Alloc_Tail_Array(stream->retired), base);
+    Init_Integer(Alloc_Tail_Array(stream->retired), end);
+
+    struct Reb_Parse_Level *level = stream->top;
+    for (; level; level = level->prior)
+        Drop_Parse_Level_Input(level, buffer, lowest);
+}
+
+// The lowest position of a SUBPARSE of a PORT!'s buffer which may still be
+// needed after the match it's about to try, given the lowest the caller
+// needs in `keep`.  Flags like COPY or AHEAD need `begin`, and `start` could
+// be gone back to if there are alternates left in the rules.
+//
+static REBCNT Parse_Stream_Keep(
+    REBFRM *f,
+    REBCNT start,
+    REBCNT begin,
+    REBFLGS flags,
+    REBCNT keep
+){
+    if ((flags & ~PF_ANY_OR_SOME) and begin < keep)
+        keep = begin;
+
+    if (start >= keep)
+        return keep;
+
+    REBCNT index;
+    struct Reb_Parse_Program *program = Get_Feed_Parse_Program(&index, f);
+    if (program)
+        return (program->alternates[index] != program->len) ? start : keep;
+
+    const RELVAL *item = P_RULE;
+    for (; NOT_END(item); ++item) {  // rule feeds are on array cells
+        if (IS_BAR(item))
+            return start;
+    }
+    return keep;
+}
+
+// Drop input no SUBPARSE of the buffer needs any more, given the lowest
+// position the running one needs.  Positions held by the SUBPARSEs are
+// adjusted, but positions a caller has in other locals must be moved down by
+// how much `dropped` went up.
+//
+static void Trim_Parse_Stream(REBFRM *f, REBCNT lowest)
+{
+    struct Reb_Parse_Stream *stream = P_STREAM;
+    assert(stream->top->frame == f and P_INPUT == stream->buffer);
+
+    struct Reb_Parse_Level *level = stream->top->prior;
+    for (; level; level = level->prior)
+        lowest = MIN(lowest, level->keep);
+
+    if (lowest >= PARSE_STREAM_CHUNK) {  // don't move the data too often
+        Drop_Parse_Stream_Input(stream, lowest);
+
+        if (P_MEMO)
+            Clear_Parse_Memo(P_MEMO);  // positions have all changed
+    }
+}
+
+// Record what the running SUBPARSE needs to keep, drop what isn't needed,
+// and refill the buffer for the match about to be tried at P_POS.
+//
+static void Update_Parse_Stream(REBFRM *f, REBCNT keep)
+{
+    struct Reb_Parse_Stream *stream = P_STREAM;
+
+    stream->top->keep = keep;
+    Trim_Parse_Stream(f, MIN(keep, P_POS));
+
+    while (
+        not stream->eof
+        and BIN_LEN(stream->buffer) - P_POS < PARSE_STREAM_CHUNK
+    ){
+        Read_Parse_Stream(stream);
+    }
+}
+
+// How much input PARSE of a PORT! has dropped so far.  A position held in a
+// local across a SUBPARSE is moved down by how much this went up.
+//
+static REBI64 Parse_Stream_Dropped(REBFRM *f)
+{
+    return P_STREAM ? P_STREAM->dropped : 0;
+}
+
+// Index in the buffer now of a position marked in PARSE of a PORT!, which is
+// either in the buffer or in one that was retired since (given `offset`, the
+// 0-based position in the port's data, if it's not a mark).  It's an error
+// if the input there was dropped.
+//
+static REBCNT Parse_Stream_Index(
+    struct Reb_Parse_Stream *stream,
+    const RELVAL *opt_mark,
+    REBI64 offset
+){
+    if (opt_mark) {
+        REBSER *s = VAL_SERIES(opt_mark);
+        if (s == SER(stream->buffer))
+            return VAL_INDEX(opt_mark);
+
+        RELVAL *item = ARR_HEAD(stream->retired);
+        for (; NOT_END(item); item += 3) {
+            if (VAL_SERIES(item) == s)
+                break;
+        }
+        if (IS_END(item)) {
+            if (
+                IS_BINARY(opt_mark)
+                and Is_Series_Frozen(s) and SER_LEN(s) == 0
+            ){
+                fail (Error_Parse_Dropped_Raw());  // retired, and forgotten
+            }
+            fail ("Switching PARSE series is not allowed");
+        }
+        offset = VAL_INT64(item + 1) + VAL_INDEX(opt_mark);
+    }
+
+    if (offset < stream->dropped)
+        fail (Error_Parse_Dropped_Raw());
+
+    offset -= stream->dropped;
+    if (offset > BIN_LEN(stream->buffer))
+        return BIN_LEN(stream->buffer);
+    return cast(REBCNT, offset);
+}
+
+
 // Subparse_Throws() is a helper that sets up a call frame and invokes the
 // SUBPARSE native--which represents one level of PARSE recursion.
 //
@@ -201,6 +938,8 @@ static bool Subparse_Throws(
     REBSPC *input_specifier,
     struct Reb_Feed *rules_feed,
     REBARR *opt_collection,
+    struct Reb_Parse_Memo *opt_memo,
+    struct Reb_Parse_Stream *opt_stream,
     REBFLGS flags
 ){
     assert(ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(input))));
@@ -236,12 +975,31 @@ static bool Subparse_Throws(
         collect_tail = 0;
     }
 
+    if (opt_memo)
+        Init_Handle_Cdata(Prep_Stack_Cell(P_MEMO_VALUE), opt_memo, 1);
+    else
+        Init_Blank(Prep_Stack_Cell(P_MEMO_VALUE));
+
+    struct Reb_Parse_Level level;
+    if (opt_stream) {
+        level.prior = opt_stream->top;
+        level.frame = f;
+        level.start = nullptr;  // SUBPARSE gives its own
+        level.begin = nullptr;
+        level.keep = P_POS;  // until SUBPARSE says what it needs
+        opt_stream->top = &level;
+
+        Init_Handle_Cdata(Prep_Stack_Cell(P_STREAM_VALUE), opt_stream, 1);
+    }
+    else
+        Init_Blank(Prep_Stack_Cell(P_STREAM_VALUE));
+
     // Need to track NUM-QUOTES somewhere that it can be read from the frame
     //
     Init_Nulled(Prep_Stack_Cell(P_NUM_QUOTES_VALUE));
 
-    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 5); // checks RETURN:
-    Init_Nulled(Prep_Stack_Cell(f->rootvar + 5));
+    assert(ACT_NUM_PARAMS(NAT_ACTION(subparse)) == 7); // checks RETURN:
+    Init_Nulled(Prep_Stack_Cell(f->rootvar + 7));
 
     // !!! By calling the subparse native here directly from its C function
     // vs. going through the evaluator, we don't get the opportunity to do
@@ -249,6 +1007,9 @@ static bool Subparse_Throws(
     //
     const REBVAL *r = N_subparse(f);
 
+    if (opt_stream)
+        opt_stream->top = level.prior;  // a fail() unwinds the PARSE too
+
     Drop_Action(f);
     Drop_Frame(f);
 
@@ -516,6 +1277,7 @@ static REB_R Parse_One_Rule(
         // has to be based on the result that comes back in P_OUT.
 
         REBCNT pos_before = P_POS;
+        REBI64 dropped = Parse_Stream_Dropped(f);
         P_POS = pos; // modify input position
 
         DECLARE_ARRAY_FEED(subfeed,
@@ -533,6 +1295,8 @@ static REB_R Parse_One_Rule(
             SPECIFIED,
             subfeed,
             P_COLLECTION,
+            P_MEMO,
+            P_STREAM,
             P_FIND_FLAGS & ~PF_ONE_RULE
         )){
             Move_Value(P_OUT, subresult);
@@ -541,6 +1305,7 @@ static REB_R Parse_One_Rule(
 
         UNUSED(interrupted); // !!! ignore "interrupted" (ACCEPT or REJECT?)
 
+        Drop_Parse_Position(&pos_before, Parse_Stream_Dropped(f) - dropped);
         P_POS = pos_before; // restore input position
 
         if (IS_NULLED(subresult))
@@ -741,6 +1506,72 @@ static REB_R Parse_One_Rule(
 }
 
 
+//
+// TO and THRU on a block of TEXT! alternates (BINARY! if the input is) like
+// `thru ["abc" | "def" | ...]` can look for all of them in one pass over the
+// input with a searcher, instead of trying each one at every position.  The
+// searcher is kept if the block is deeply frozen.  Otherwise one is only
+// made if there are PARSE_SEARCHER_MIN alternates.
+//
+static bool Did_Search_Alternates(
+    REBIXO *out,
+    REBFRM *f,
+    const RELVAL *rule_block,
+    bool is_thru
+){
+    bool binary = (P_TYPE == REB_BINARY);
+
+    REBARR *a = VAL_ARRAY(rule_block);
+    REBCNT num_alternates = 0;
+    const RELVAL *item = ARR_HEAD(a);  // TO and THRU ignore the index
+    while (true) {
+        if (VAL_TYPE(item) != (binary ? REB_BINARY : REB_TEXT))
+            return false;
+        if (VAL_LEN_AT(item) == 0)
+            return false;
+        ++num_alternates;
+
+        ++item;
+        if (IS_END(item))
+            break;
+        if (not IS_BAR(item))
+            return false;
+        ++item;
+    }
+
+    bool uncase = not binary and not P_HAS_CASE;
+
+    struct Reb_Searcher *s;
+    struct Reb_Parse_Program *program = Get_Parse_Program(a);
+    if (program) {
+        s = program->searchers[uncase];
+        if (not s) {
+            s = Make_Searcher(ARR_HEAD(a), VAL_SPECIFIER(rule_block), uncase);
+            program->searchers[uncase] = s;
+        }
+    }
+    else if (num_alternates >= PARSE_SEARCHER_MIN)
+        s = Make_Searcher(ARR_HEAD(a), VAL_SPECIFIER(rule_block), uncase);
+    else
+        return false;
+
+    REBCNT len;
+    REBCNT which;
+    REBCNT i = Find_With_Searcher(
+        &len, &which, s, P_INPUT, P_POS, SER_LEN(P_INPUT), not binary
+    );
+
+    if (not program)
+        Free_Searcher(s);
+
+    if (i == NOT_FOUND)
+        *out = END_FLAG;
+    else
+        *out = is_thru ? i + len : i;
+    return true;
+}
+
+
 //
 //  To_Thru_Block_Rule: C
 //
@@ -757,6 +1588,12 @@ static REBIXO To_Thru_Block_Rule(
     const RELVAL *rule_block,
     bool is_thru
 ) {
+    if (not ANY_ARRAY_OR_PATH_KIND(P_TYPE)) {
+        REBIXO i;
+        if (Did_Search_Alternates(&i, f, rule_block, is_thru))
+            return i;
+    }
+
     DECLARE_LOCAL (cell); // holds evaluated rules (use frame cell instead?)
 
     REBCNT pos = P_POS;
@@ -845,14 +1682,17 @@ static REBIXO To_Thru_Block_Rule(
                 }
                 else if (IS_BINARY(rule)) {
                     REBCNT len = VAL_LEN_AT(rule);
-                    if (0 == Compare_Bytes(
-                        BIN_AT(P_INPUT, pos),
-                        VAL_BIN_AT(rule),
-                        len,
-                        false
-                    )) {
+                    if (
+                        pos + len <= BIN_LEN(P_INPUT)
+                        and 0 == Compare_Bytes(
+                            BIN_AT(P_INPUT, pos),
+                            VAL_BIN_AT(rule),
+                            len,
+                            false
+                        )
+                    ){
                         if (is_thru)
-                            return pos + 1;
+                            return pos + len;
                         return pos;
                     }
                 }
@@ -1050,6 +1890,67 @@ static REBIXO To_Thru_Non_Block_Rule(
 }
 
 
+//
+//  To_Thru_Stream_Rule: C
+//
+// TO and THRU in PARSE of a PORT! search the input that's been read, and if
+// that's not enough to say where the match is, read more and search again.
+// So they go on until found or the port's data ends.  What they search past
+// is dropped as they go (unless an alternate or COPY etc. needs it), so e.g.
+// `thru "needle"` in a huge file only holds a few chunks of it in memory.
+//
+// A match is only trusted with a chunk of input after it, since a longer
+// alternate starting before it could have been cut off by the end of the
+// buffer.  (So alternates in a TO or THRU block are only found reliably if
+// they're no longer than PARSE_STREAM_CHUNK.)
+//
+static REBIXO To_Thru_Stream_Rule(
+    REBFRM *f,
+    const RELVAL *rule,
+    bool is_thru
+){
+    if (IS_BLANK(rule) or IS_LOGIC(rule))  // no search, see non-block rule
+        return To_Thru_Non_Block_Rule(f, rule, is_thru);
+
+    struct Reb_Parse_Stream *stream = P_STREAM;
+
+    REBCNT pos = P_POS;  // P_POS is where to search from, until the end
+    REBI64 dropped = stream->dropped;
+
+    REBIXO i;
+    while (true) {
+        if (IS_BLOCK(rule))
+            i = To_Thru_Block_Rule(f, rule, is_thru);
+        else
+            i = To_Thru_Non_Block_Rule(f, rule, is_thru);
+
+        if (i == THROWN_FLAG or stream->eof)
+            break;
+
+        REBCNT len = BIN_LEN(stream->buffer);
+        if (i != END_FLAG and i + PARSE_STREAM_CHUNK <= len)
+            break;
+
+        // No match can start more than two chunks before the end (one for
+        // the length of a cut off alternate, one for a THRU's length).
+        //
+        if (
+            len > 2 * PARSE_STREAM_CHUNK
+            and P_POS < len - 2 * PARSE_STREAM_CHUNK
+        ){
+            P_POS = len - 2 * PARSE_STREAM_CHUNK;
+        }
+
+        Trim_Parse_Stream(f, MIN(stream->top->keep, P_POS));  // moves P_POS
+        Read_Parse_Stream(stream);
+    }
+
+    Drop_Parse_Position(&pos, stream->dropped - dropped);
+    P_POS = pos;
+    return i;
+}
+
+
 //
 //  Do_Eval_Rule: C
 //
@@ -1260,11 +2161,18 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
         if (index < 1)
             fail ("Cannot SEEK a negative integer position");
         --index;  // Rebol is 1-based, C is 0 based...
+
+        if (P_STREAM)  // a position in the port's data
+            index = Parse_Stream_Index(P_STREAM, nullptr, index);
     }
     else if (ANY_SERIES_KIND(k)) {
-        if (VAL_SERIES(rule) != P_INPUT)
-            fail ("Switching PARSE series is not allowed");
-        index = VAL_INDEX(rule);
+        if (P_STREAM)  // may be a mark in input that's since been dropped
+            index = Parse_Stream_Index(P_STREAM, rule, 0);
+        else {
+            if (VAL_SERIES(rule) != P_INPUT)
+                fail ("Switching PARSE series is not allowed");
+            index = VAL_INDEX(rule);
+        }
     }
     else {  // #1263
         DECLARE_LOCAL (specific);
@@ -1306,6 +2214,10 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
 //      find-flags [integer!]
 //      collection "Array into which any KEEP values are collected"
 //          [blank! any-series!]
+//      memo "Results of rule blocks, if PARSE/MEMO"
+//          [blank! handle!]
+//      stream "Port input is read from, if top level PARSE of a PORT!"
+//          [blank! handle!]
 //      <local> num-quotes
 //  ]
 //
@@ -1343,6 +2255,8 @@ REBNATIVE(subparse)
     UNUSED(ARG(input));  // used via P_INPUT
     UNUSED(ARG(find_flags));  // used via P_FIND_FLAGS
     UNUSED(ARG(num_quotes));  // used via P_NUM_QUOTES_VALUE
+    UNUSED(ARG(memo));  // used via P_MEMO
+    UNUSED(ARG(stream));  // used via P_STREAM
 
     REBFRM *f = frame_; // nice alias of implicit native parameter
 
@@ -1398,6 +2312,11 @@ REBNATIVE(subparse)
     REBCNT start = P_POS; // recovery restart point
     REBCNT begin = P_POS; // point at beginning of match
 
+    if (P_STREAM) {  // PARSE of a PORT! moves these when input is dropped
+        P_STREAM->top->start = &start;
+        P_STREAM->top->begin = &begin;
+    }
+
     // The loop iterates across each REBVAL's worth of "rule" in the rule
     // block.  Some of these rules just set `flags` and `continue`, so that
     // the flags will apply to the next rule item.  If the flag is PF_SET
@@ -1426,6 +2345,13 @@ REBNATIVE(subparse)
     f->was_eval_called = true;
   #endif
 
+    if (
+        not (P_FIND_FLAGS & PF_ONE_RULE)  // feed is shared with parent
+        and not Did_Seek_Possible_Alternate(f)
+    ){
+        return Init_Nulled(D_OUT);
+    }
+
     while (true) {  // not `while (NOT_END`, see DEBUG_ENSURE_FRAME_EVALUATES
 
         /* Print_Parse_Index(f); */
@@ -1591,6 +2517,11 @@ REBNATIVE(subparse)
                     );
                     PUSH_GC_GUARD(collection);
 
+                    if (P_STREAM)  // the result will be the new position
+                        P_STREAM->top->keep = Parse_Stream_Keep(
+                            f, start, begin, flags, NOT_FOUND
+                        );
+
                     bool interrupted;
                     assert(IS_END(P_OUT));  // invariant until finished
                     bool threw = Subparse_Throws(
@@ -1600,6 +2531,8 @@ REBNATIVE(subparse)
                         SPECIFIED,
                         f->feed,
                         collection,
+                        P_MEMO,
+                        P_STREAM,
                         P_FIND_FLAGS | PF_ONE_RULE
                     );
 
@@ -1644,6 +2577,12 @@ REBNATIVE(subparse)
                         only = false;
 
                     REBCNT pos_before = P_POS;
+                    REBI64 dropped = Parse_Stream_Dropped(f);
+
+                    if (P_STREAM)  // input from here on is kept
+                        P_STREAM->top->keep = Parse_Stream_Keep(
+                            f, start, begin, flags, pos_before
+                        );
 
                     rule = Get_Parse_Value(save, P_RULE, P_RULE_SPECIFIER);
 
@@ -1703,6 +2642,8 @@ REBNATIVE(subparse)
                             SPECIFIED,
                             f->feed,
                             P_COLLECTION,
+                            P_MEMO,
+                            P_STREAM,
                             P_FIND_FLAGS | PF_ONE_RULE
                         );
 
@@ -1718,6 +2659,11 @@ REBNATIVE(subparse)
                         REBCNT pos_after = VAL_INT32(P_OUT);
                         SET_END(P_OUT);  // restore invariant
 
+                        Drop_Parse_Position(
+                            &pos_before,
+                            Parse_Stream_Dropped(f) - dropped
+                        );
+
                         assert(pos_after >= pos_before);  // 0 or more matches
 
                         REBARR *target;
@@ -2041,6 +2987,18 @@ REBNATIVE(subparse)
         REBINT count; // gotos would cross initialization
         count = 0;
         while (count < maxcount) {
+            if (P_STREAM) {
+                //
+                // The position is needed again if the match fails after
+                // enough matches were made to go on from here.  Otherwise
+                // the match's result is where things go on from.
+                //
+                Update_Parse_Stream(f, Parse_Stream_Keep(
+                    f, start, begin, flags,
+                    (count >= mincount) ? P_POS : NOT_FOUND
+                ));
+            }
+
             assert(
                 not IS_BAR(rule)
                 and not IS_BLANK(rule)
@@ -2081,7 +3039,9 @@ REBNATIVE(subparse)
 
                     bool is_thru = (cmd == SYM_THRU);
 
-                    if (IS_BLOCK(subrule))
+                    if (P_STREAM)
+                        i = To_Thru_Stream_Rule(f, subrule, is_thru);
+                    else if (IS_BLOCK(subrule))
                         i = To_Thru_Block_Rule(f, subrule, is_thru);
                     else
                         i = To_Thru_Non_Block_Rule(f, subrule, is_thru);
@@ -2228,6 +3188,8 @@ REBNATIVE(subparse)
                         P_INPUT_SPECIFIER,  // harmless if specified API value
                         subrules_feed,
                         P_COLLECTION,
+                        P_MEMO,
+                        nullptr,  // INTO input isn't a PORT!'s buffer
                         P_FIND_FLAGS
                     )){
                         return R_THROWN;
@@ -2276,6 +3238,10 @@ REBNATIVE(subparse)
                     fail (Error_Parse_Rule());
                 }
             }
+            else if (IS_BLOCK(rule) and Did_Find_Parse_Memo(&i, f, rule)) {
+                //
+                // PARSE/MEMO already tried this block here, `i` is result
+            }
             else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
 
                 DECLARE_ARRAY_FEED (subrules_feed,
@@ -2284,6 +3250,11 @@ REBNATIVE(subparse)
                     P_RULE_SPECIFIER
                 );
 
+                // If the rules change the input, positions remembered before
+                // are gone...and so is the position this block started at.
+                //
+                REBCNT generation = P_MEMO ? P_MEMO->generation : 0;
+
                 bool interrupted;
                 if (Subparse_Throws(
                     &interrupted,
@@ -2292,6 +3263,8 @@ REBNATIVE(subparse)
                     SPECIFIED,
                     subrules_feed,
                     P_COLLECTION,
+                    P_MEMO,
+                    P_STREAM,
                     P_FIND_FLAGS & ~(PF_ONE_RULE)
                 )) {
                     Move_Value(P_OUT, P_CELL);
@@ -2315,6 +3288,48 @@ REBNATIVE(subparse)
                         P_POS = cast(REBCNT, i);
                     break;
                 }
+
+                if (
+                    P_MEMO
+                    and not P_COLLECTION
+                    and P_MEMO->generation == generation
+                ){
+                    Memoize_Parse_Result(f, rule, P_POS, i);
+                }
+            }
+            else if (
+                IS_BITSET(rule)
+                and not IS_SER_ARRAY(P_INPUT)
+                and not P_STREAM  // spanning could skip the buffer refill
+                and maxcount - count > 1
+            ){
+                // Match as many characters in the set as the count allows in
+                // one step, vs. one per iteration of this loop.
+                //
+                REBCNT n;
+                if (P_TYPE == REB_BINARY)
+                    n = Span_Bin_Bitset(
+                        P_INPUT,
+                        P_POS,
+                        maxcount - count,
+                        VAL_BITSET(rule),
+                        not P_HAS_CASE
+                    );
+                else
+                    n = Span_Str_Bitset(
+                        STR(P_INPUT),
+                        P_POS,
+                        maxcount - count,
+                        VAL_BITSET(rule),
+                        not P_HAS_CASE
+                    );
+
+                if (n == 0)
+                    i = END_FLAG;
+                else {
+                    i = P_POS + n;
+                    count += n - 1;  // the last is counted after the match
+                }
             }
             else {
                 // Parse according to datatype
@@ -2398,7 +3413,7 @@ REBNATIVE(subparse)
 
             if (P_POS == NOT_FOUND) {
                 if (flags & PF_THEN) {
-                    FETCH_TO_BAR_OR_END(f);
+                    Fetch_To_Bar_Or_End(f);
                     if (NOT_END(P_RULE))
                         FETCH_NEXT_RULE(f);
                 }
@@ -2530,6 +3545,9 @@ REBNATIVE(subparse)
                     }
                 }
 
+                if ((flags & (PF_REMOVE | PF_INSERT | PF_CHANGE)) and P_MEMO)
+                    Clear_Parse_Memo(P_MEMO);  // input positions will move
+
                 if (flags & PF_REMOVE) {
                     FAIL_IF_READ_ONLY(P_INPUT_VALUE);
                     if (count)
@@ -2659,7 +3677,7 @@ REBNATIVE(subparse)
             if (P_COLLECTION)
                 TERM_ARRAY_LEN(P_COLLECTION, collection_tail);
 
-            FETCH_TO_BAR_OR_END(f);
+            Fetch_To_Bar_Or_End(f);
             if (IS_END(P_RULE)) // no alternate rule
                 return Init_Nulled(D_OUT);
 
@@ -2667,6 +3685,9 @@ REBNATIVE(subparse)
             //
             FETCH_NEXT_RULE(f);
             P_POS = begin = start;
+
+            if (not Did_Seek_Possible_Alternate(f))
+                return Init_Nulled(D_OUT);
         }
 
         if (P_FIND_FLAGS & PF_ONE_RULE)  // don't loop
@@ -2686,12 +3707,13 @@ REBNATIVE(subparse)
 //  "Parse series according to grammar rules, return last match position"
 //
 //      return: "null if rules failed, else terminal position of match"
-//          [<opt> any-series! quoted!]
-//      input "Input series to parse"
-//          [<blank> any-series! quoted!]
+//          [<opt> any-series! quoted! port!]
+//      input "Input series to parse (a PORT! is read as it's parsed)"
+//          [<blank> any-series! quoted! port!]
 //      rules "Rules to parse by"
 //          [<blank> block!]
 //      /case "Uses case-sensitive comparison"
+//      /memo "Reuse results of rule blocks retried at the same position"
 //  ]
 //
 REBNATIVE(parse)
@@ -2704,8 +3726,35 @@ REBNATIVE(parse)
 {
     INCLUDE_PARAMS_OF_PARSE;
 
-    if (not ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(ARG(input)))))
+    if (
+        not IS_PORT(ARG(input))
+        and not ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(ARG(input))))
+    ){
         fail ("PARSE input must be an ANY-SERIES! (use AS BLOCK! for PATH!)");
+    }
+
+    // PARSE of a PORT! parses a BINARY! buffer of what's been read from it.
+    // The port is given back if the rules match.
+    //
+    struct Reb_Parse_Stream stream;
+    DECLARE_LOCAL (buffer);
+    DECLARE_LOCAL (retired);
+    REBVAL *input;
+    if (IS_PORT(ARG(input))) {
+        stream.port = ARG(input);
+        stream.buffer_value = buffer;
+        stream.buffer = Make_Binary(PARSE_STREAM_CHUNK);
+        stream.retired = Make_Array(3);
+        stream.eof = false;
+        stream.dropped = 0;
+        stream.top = nullptr;
+        input = Init_Binary(buffer, stream.buffer);
+        PUSH_GC_GUARD(buffer);
+        Init_Block(retired, stream.retired);
+        PUSH_GC_GUARD(retired);
+    }
+    else
+        input = ARG(input);
 
     DECLARE_ARRAY_FEED (rules_feed,
         VAL_ARRAY(ARG(rules)),
@@ -2713,18 +3762,42 @@ REBNATIVE(parse)
         VAL_SPECIFIER(ARG(rules))
     );
 
+    struct Reb_Parse_Memo memo;
+    if (REF(memo)) {
+        Init_Parse_Memo_Table(&memo, PARSE_MEMO_MIN_SIZE);
+        memo.generation = 0;
+        memo.held = Make_Array_Core(PARSE_MEMO_MIN_SIZE, NODE_FLAG_MANAGED);
+        memo.last_rules = nullptr;
+        memo.last_input = nullptr;
+        PUSH_GC_GUARD(memo.held);
+    }
+
     bool interrupted;
-    if (Subparse_Throws(
+    bool threw = Subparse_Throws(
         &interrupted,
         SET_END(D_OUT),
-        ARG(input), SPECIFIED,
+        input, SPECIFIED,
         rules_feed,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
+        REF(memo) ? &memo : nullptr,
+        IS_PORT(ARG(input)) ? &stream : nullptr,
         REF(case) ? AM_FIND_CASE : 0
         //
         // We always want "case-sensitivity" on binary bytes, vs. treating
         // as case-insensitive bytes for ASCII characters.
-    )){
+    );
+
+    if (REF(memo)) {
+        DROP_GC_GUARD(memo.held);
+        Free_Unmanaged_Series(memo.table);
+    }
+
+    if (IS_PORT(ARG(input))) {
+        DROP_GC_GUARD(retired);
+        DROP_GC_GUARD(buffer);
+    }
+
+    if (threw) {
         // Any PARSE-specific THROWs (where a PARSE directive jumped the
         // stack) should be handled here.  However, RETURN was eliminated,
         // in favor of enforcing a more clear return value protocol for PARSE
@@ -2735,6 +3808,9 @@ REBNATIVE(parse)
     if (IS_NULLED(D_OUT))
         return nullptr;
 
+    if (IS_PORT(ARG(input)))
+        RETURN (ARG(input));
+
     REBCNT progress = VAL_UINT32(D_OUT);
     assert(progress <= VAL_LEN_HEAD(ARG(input)));
     Move_Value(D_OUT, ARG(input));
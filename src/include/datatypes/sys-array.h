@@ -265,6 +265,8 @@ inline static REBARR *Make_Array_Core(REBCNT capacity, REBFLGS flags) {
             GC_Manuals->content.dynamic.used++
         ] = s; // start out managed to not need to find/remove from this later
     }
+    else
+        Track_Young_Series(s);
 
     // Arrays created at runtime default to inheriting the file and line
     // number from the array executing in the current frame.
@@ -106,6 +106,10 @@
 #define LINK_ANCESTOR_NODE(s)       LINK(s).custom.node
 #define LINK_ANCESTOR(s)            ARR(LINK_ANCESTOR_NODE(s))
 
+inline static void INIT_LINK_ANCESTOR(REBARR *keylist, REBARR *ancestor) {
+    LINK_ANCESTOR_NODE(keylist) = NOD(ancestor);
+}
+
 
 #define CTX_VARLIST(c) \
     (&(c)->varlist)
@@ -276,7 +280,7 @@ inline static REBCTX *VAL_WORD_CONTEXT(const REBVAL *v) {
         GET_SERIES_FLAG(binding, MANAGED)
         or IS_END(FRM(LINK_KEYSOURCE(binding))->param)  // not "fulfilling"
     );
-    binding->header.bits |= NODE_FLAG_MANAGED;  // !!! review managing needs
+    Manage_Untracked_Series(SER(binding));  // !!! review managing needs
     REBCTX *c = CTX(binding);
     FAIL_IF_INACCESSIBLE_CTX(c);
     return c;
@@ -269,11 +269,40 @@ inline static REBYTE *SER_LAST_RAW(size_t w, REBSER *s) {
     ((SER_USED(s) + (n) + 1) <= SER_REST(s))
 
 
+//
+// Write barrier for the generational GC.  Anything that changes a series in a
+// way that might make it refer to a series it didn't before must call this,
+// or a minor recycle could free that series while it is still in use.  (So
+// could an incremental recycle, if one of its steps scanned the series.)
+// Some routes for writing to series do it for you: Expand_Series(),
+// Get_Mutable_Var_May_Fail() and the binding routines like Bind_Values_Core()
+// (which take the array).  But code writing cells of an existing array
+// directly (e.g. with ARR_AT() or CTX_VAR()) must call it itself, unless it
+// made the array since the last evaluation that could recycle.
+//
+// It only costs a test of the info bits unless the series is old and hasn't
+// been written since the last recycle.  Still, FAIL_IF_READ_ONLY_SER() and
+// EXPAND_SERIES_TAIL() are on the hottest paths there are, and only builds
+// with INCLUDE_GENERATIONAL_RECYCLE need them to run it.  (An incremental
+// recycle rescans what its steps scanned anyway, see Remark_Scanned_Series())
+//
+inline static void Remember_Series(REBSER *s) {
+    if (
+        (s->info.bits & (SERIES_INFO_SCANNED | SERIES_INFO_REMEMBERED))
+        == SERIES_INFO_SCANNED
+    ){
+        Remember_Scanned_Series(s);
+    }
+}
+
 //
 // Optimized expand when at tail (but, does not reterminate)
 //
 
 inline static void EXPAND_SERIES_TAIL(REBSER *s, REBCNT delta) {
+  #if defined(INCLUDE_GENERATIONAL_RECYCLE)
+    Remember_Series(s);
+  #endif
     if (SER_FITS(s, delta))
         SET_SERIES_USED(s, SER_USED(s) + delta);
     else
@@ -379,6 +408,29 @@ inline static void Untrack_Manual_Series(REBSER *s)
     --GC_Manuals->content.dynamic.used;
 }
 
+// When generational recycling is enabled, series handed to the GC are noted
+// in the GC_Nursery.  A minor recycle only sweeps the nursery, and treats any
+// series that survived a previous recycle as live.  If the nursery fills up,
+// a recycle is signaled and the overflow is simply not logged--such series
+// are still sound to leave alone (if a minor recycle reaches them, they are
+// promoted like the logged ones) and will be considered by the next full
+// recycle.  (See Recycle_Core() for the other half of this.)
+//
+inline static void Track_Young_Series(REBSER *s)
+{
+    if (not GC_Generational)
+        return;
+
+    if (SER_FULL(GC_Nursery)) {
+        SET_SIGNAL(SIG_RECYCLE);
+        return;
+    }
+
+    cast(REBSER**, GC_Nursery->content.dynamic.data)[
+        GC_Nursery->content.dynamic.used++
+    ] = s;
+}
+
 // Rather than free a series, this function can be used--which will transition
 // a manually managed series to be one managed by the GC.  There is no way to
 // transition back--once a series has become managed, only the GC can free it.
@@ -395,9 +447,22 @@ inline static REBSER *Manage_Series(REBSER *s)
     s->header.bits |= NODE_FLAG_MANAGED;
 
     Untrack_Manual_Series(s);
+    Track_Young_Series(s);
     return s;
 }
 
+// Frame varlists aren't made by the usual series creation routines, so they
+// are not in the GC_Manuals list that Manage_Series() takes them out of.
+// When a FRAME! for one is made, this hands it to the GC instead of setting
+// NODE_FLAG_MANAGED directly, so it gets logged in the nursery.
+//
+inline static void Manage_Untracked_Series(REBSER *s) {
+    if (s->header.bits & NODE_FLAG_MANAGED)
+        return;
+    s->header.bits |= NODE_FLAG_MANAGED;
+    Track_Young_Series(s);
+}
+
 inline static REBSER *Ensure_Series_Managed(void *p) {
     REBSER *s = SER(p);
     if (NOT_SERIES_FLAG(s, MANAGED))
@@ -497,8 +562,12 @@ inline static bool Is_Series_Read_Only(REBSER *s) { // may be temporary...
 //
 
 inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
-    if (not Is_Series_Read_Only(s))
+    if (not Is_Series_Read_Only(s)) {
+      #if defined(INCLUDE_GENERATIONAL_RECYCLE)
+        Remember_Series(s);  // checked because it's about to be written
+      #endif
         return;
+    }
 
     if (GET_SERIES_INFO(s, AUTO_LOCKED))
         fail (Error_Series_Auto_Locked_Raw());
@@ -734,6 +803,12 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBCNT length) {
         Mem_Pools[SYSTEM_POOL].free++;
     }
 
+    if (PG_Pool_Tuning) {  // histogram, for Dump_Pools() and STATS/POOLS
+        REBPOL *pool = &Mem_Pools[pool_num];
+        ++pool->requests;
+        pool->wasted += size - (length * wide);
+    }
+
     // Note: Bias field may contain other flags at some point.  Because
     // SER_SET_BIAS() uses bit masking on an existing value, we are sure
     // here to clear out the whole value for starters.
@@ -819,6 +894,8 @@ inline static REBSER *Make_Series_Core(
             GC_Manuals->content.dynamic.used++
         ] = s; // start out managed to not need to find/remove from this later
     }
+    else
+        Track_Young_Series(s);
 
     return s;
 }
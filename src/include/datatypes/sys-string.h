@@ -32,12 +32,13 @@
 // * Avoiding loops which try to access by index, and instead make it easier
 //   to smoothly traverse known good UTF-8 data using REBCHR(*).
 //
-// * Monitoring strings if they are ASCII only and using that to make an
-//   optimized jump.  !!! Work in progress, see notes below.
+// * Noticing strings that are ASCII only and using that to make an
+//   optimized jump.  See notes below.
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  A big string gets a sparse index of
+//   them, which is filled in lazily and patched when the string changes.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -342,28 +343,31 @@ inline static bool IS_SER_STRING(REBSER *s) {
     NOT_SERIES_FLAG((s), UTF8_NONWORD)
 
 
-//=//// STRING ALL-ASCII FLAG /////////////////////////////////////////////=//
+//=//// STRING ALL-ASCII CHECK ////////////////////////////////////////////=//
 //
-// One of the best optimizations that can be done on strings is to keep track
-// of if they contain only ASCII codepoints.  Such a flag would likely have
-// false negatives, unless all removals checked the removed portion for if
-// the ASCII flag is true.  It could be then refreshed by any routine that
-// walks an entire string for some other reason (like molding or printing).
+// One of the best optimizations that can be done on strings is to know if
+// they contain only ASCII codepoints, because then the codepoint index is
+// the same as the byte offset.  Rather than keep a flag that every mutation
+// would have to maintain (and that would have false negatives unless all
+// removals checked what they removed), this notices that a string is all
+// ASCII exactly when its cached length in codepoints equals its size in
+// bytes.  Every mutation already has to keep those two numbers right, so the
+// check is O(1) and never out of date.
 //
-// For the moment, we punt on this optimization.  The main reason is that it
-// means the non-ASCII code is exercised on every code path, which is a good
-// substitute for finding high-codepoint data to pass through to places that
-// would not receive it otherwise.
+// Symbols don't cache their length, so they are never considered ASCII here
+// (they're short, and have no bookmarks to keep in sync anyway).
 //
-// But ultimately this optimization will be necessary, and decisions on how
-// up-to-date the flag should be kept would need to be made.
-
-#define Is_Definitely_Ascii(s) false
+// DEBUG_UTF8_NO_ASCII_SHORTCUT turns the check off, so that the non-ASCII
+// code is exercised on every code path.  That's a good substitute for finding
+// high-codepoint data to pass through to places that would not get it.
+//
+#if defined(DEBUG_UTF8_NO_ASCII_SHORTCUT)
+    #define Is_Definitely_Ascii(s) false
+#else
+    #define Is_Definitely_Ascii(s) \
+        (not IS_STR_SYMBOL(s) and MISC(s).length == SER_USED(SER(s)))
+#endif
 
-inline static bool Is_String_Definitely_ASCII(const RELVAL *str) {
-    UNUSED(str);
-    return false;
-}
 
 inline static const char *STR_UTF8(REBSTR *s) {
     return cast(const char*, BIN_HEAD(SER(s)));
@@ -390,12 +394,9 @@ inline static REBCHR(*) STR_LAST(REBSTR *s) {
 }
 
 inline static REBCNT STR_LEN(REBSTR *s) {
-    if (Is_Definitely_Ascii(s))
-        return STR_SIZE(s);
-
     if (not IS_STR_SYMBOL(s)) {  // length is cached for non-ANY-WORD! strings
       #if defined(DEBUG_UTF8_EVERYWHERE)
-        if (MISC(s).length > SER_USED(s)) // includes 0xDECAFBAD
+        if (MISC(s).length > SER_USED(SER(s)))  // includes 0xDECAFBAD
             panic(s);
       #endif
         return MISC(s).length;
@@ -422,7 +423,7 @@ inline static REBCNT STR_INDEX_AT(REBSTR *s, REBSIZ offset) {
 
     if (not IS_STR_SYMBOL(s)) {  // length is cached for non-ANY-WORD! strings
       #if defined(DEBUG_UTF8_EVERYWHERE)
-        if (MISC(s).length > SER_USED(s)) // includes 0xDECAFBAD
+        if (MISC(s).length > SER_USED(SER(s)))  // includes 0xDECAFBAD
             panic(s);
       #endif
 
@@ -456,6 +457,9 @@ inline static REBCNT SER_LEN(REBSER *s) {  // Generic REBSER length
 inline static void SET_STR_LEN_SIZE(REBSTR *s, REBCNT len, REBSIZ used) {
     assert(not IS_STR_SYMBOL(s));
 
+    if (LINK(s).bookmarks and len < MISC(s).length)
+        Trim_Bookmarks(s, len);  // any past the new tail are no good
+
     SET_SERIES_USED(SER(s), used);
     MISC(s).length = len;
 }
@@ -469,56 +473,90 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBCNT len, REBSIZ used) {
 
 //=//// CACHED ACCESSORS AND BOOKMARKS ////////////////////////////////////=//
 //
-// A "bookmark" in this terminology is simply a small REBSER-sized node which
-// holds a mapping from an index to an offset in a string.  It is pointed to
-// by the string's LINK() field in the series node.
+// A "bookmark" in this terminology is simply a cell which holds a mapping
+// from an index to an offset in a string.  A string which has had STR_AT()
+// run on it gets an array of these, pointed to by the string's LINK() field
+// in the series node.
+//
+// The first bookmark in the array is the position of the last access, which
+// speeds up the most common case of an iteration.  The rest are a sparse
+// index sorted by codepoint index, which is filled in lazily: any time the
+// nearest bookmark to a position asked for was STR_BOOKMARK_SPAN or more
+// codepoints away, that position is added.  So a large string accessed all
+// over gets about one bookmark per span, and getting to any index in it only
+// scans about half a span (alternating between distant positions, or seeking
+// to marks from PARSE, doesn't degrade to scanning from the head).
+//
+// Modifications patch the bookmarks with Update_Bookmarks(), which shifts
+// the ones after the change.  Truncating a string with SET_STR_LEN_SIZE()
+// drops any past the new tail, and code that rewrites the content after some
+// index in place has to Trim_Bookmarks() to that index.
+//
+
+#define STR_BOOKMARK_SPAN 1024  // codepoints between bookmarks in the index
 
-#define BMK_INDEX(b) \
-    PAYLOAD(Bookmark, ARR_SINGLE(b)).index
+#define BMK_INDEX(b,n) \
+    PAYLOAD(Bookmark, ARR_AT((b), (n))).index
 
-#define BMK_OFFSET(b) \
-    PAYLOAD(Bookmark, ARR_SINGLE(b)).offset
+#define BMK_OFFSET(b,n) \
+    PAYLOAD(Bookmark, ARR_AT((b), (n))).offset
 
-inline static REBBMK* Alloc_Bookmark(void) {
-    REBARR *bookmark = Alloc_Singular(SERIES_FLAG_MANAGED);
-    CLEAR_SERIES_FLAG(bookmark, MANAGED);  // so it's manual but untracked
-    LINK(bookmark).bookmarks = nullptr;
-    RESET_CELL(ARR_SINGLE(bookmark), REB_X_BOOKMARK, CELL_MASK_NONE);
+inline static void Init_Bookmark(RELVAL *out, REBCNT index, REBSIZ offset) {
+    RESET_CELL(out, REB_X_BOOKMARK, CELL_MASK_NONE);
 
     // For the moment, REB_X_BOOKMARK is a high numbered type, which keeps
     // it out of the type list *but* means it claims bindability.  Setting
     // its mirror byte to claim it is REB_LOGIC preserves some debuggability
     // (its main type is still bookmark) but makes Is_Bindable() false
     //
-    mutable_MIRROR_BYTE(ARR_SINGLE(bookmark)) = REB_LOGIC;
-    return bookmark;
+    mutable_MIRROR_BYTE(out) = REB_LOGIC;
+
+    PAYLOAD(Bookmark, out).index = index;
+    PAYLOAD(Bookmark, out).offset = offset;
+}
+
+inline static REBBMK* Alloc_Bookmarks(void) {
+    REBARR *bookmarks = Make_Array_Core(
+        4,  // last access, plus room for a few index entries
+        SERIES_FLAG_MANAGED | SERIES_FLAG_ALWAYS_DYNAMIC
+    );
+    CLEAR_SERIES_FLAG(bookmarks, MANAGED);  // so it's manual but untracked
+    Init_Bookmark(Alloc_Tail_Array(bookmarks), 0, 0);
+    return bookmarks;
 }
 
 inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
     assert(not IS_STR_SYMBOL(s));  // call on string
     if (LINK(s).bookmarks)
-        GC_Kill_Series(SER(LINK(s).bookmarks));  // recursive free whole list
+        GC_Kill_Series(SER(LINK(s).bookmarks));  // one array has them all
     LINK(s).bookmarks = nullptr;
 }
 
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(REBSTR *s) {
-        REBBMK *bookmark = LINK(s).bookmarks;
-        if (not bookmark)
+        REBBMK *bookmarks = LINK(s).bookmarks;
+        if (not bookmarks)
             return;
 
-        assert(not LINK(SER(bookmark)).bookmarks);
+        REBCNT n;
+        for (n = 0; n < ARR_LEN(bookmarks); ++n) {
+            REBCNT index = BMK_INDEX(bookmarks, n);
+            REBSIZ offset = BMK_OFFSET(bookmarks, n);
 
-        REBCNT index = BMK_INDEX(bookmark);
-        REBSIZ offset = BMK_OFFSET(bookmark);
+            assert(index <= STR_LEN(s));
+            if (n > 1)  // the index is sorted (but not the last access)
+                assert(index > BMK_INDEX(bookmarks, n - 1));
 
-        REBCHR(*) cp = STR_HEAD(s);
-        REBCNT i;
-        for (i = 0; i != index; ++i)
-            cp = NEXT_STR(cp);
+            REBCHR(*) cp = STR_HEAD(s);
+            REBCNT i;
+            for (i = 0; i != index; ++i)
+                cp = NEXT_STR(cp);
 
-        REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
-        assert(actual == offset);
+            REBSIZ actual = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+            assert(actual == offset);
+            UNUSED(actual);
+            UNUSED(offset);
+        }
     }
 #endif
 
@@ -531,111 +569,33 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *s) {
 inline static REBCHR(*) STR_AT(REBSTR *s, REBCNT at) {
     assert(at <= STR_LEN(s));
 
-    if (Is_Definitely_Ascii(s)) {  // can't have any false positives
-        assert(not LINK(s).bookmarks);  // mutations must ensure this
+    if (Is_Definitely_Ascii(s))  // can't have any false positives
         return cast(REBCHR(*), cast(REBYTE*, STR_HEAD(s)) + at);
-    }
 
     REBCHR(*) cp;  // can be used to calculate offset (relative to STR_HEAD())
     REBCNT index;
 
-    REBBMK *bookmark = nullptr;  // updated at end if not nulled out
-    if (not IS_STR_SYMBOL(s))
-        bookmark = LINK(s).bookmarks;
-
-  #if defined(DEBUG_SPORADICALLY_DROP_BOOKMARKS)
-    if (bookmark and SPORADICALLY(100)) {
-        Free_Bookmarks_Maybe_Null(s);
-        bookmark = nullptr;
-    }
-  #endif
-
     REBCNT len = STR_LEN(s);
-    if (at < len / 2) {
-        if (len < sizeof(REBVAL)) {
-            if (not IS_STR_SYMBOL(s))
-                assert(not bookmark);  // mutations must ensure this
-            goto scan_from_head;  // good locality, avoid bookmark logic
+    if (IS_STR_SYMBOL(s) or len < sizeof(REBVAL)) {  // good locality...
+        if (at < len / 2) {  // ...so avoid bookmark logic
+            cp = STR_HEAD(s);
+            for (index = 0; index != at; ++index)
+                cp = NEXT_STR(cp);
         }
-        if (not bookmark and not IS_STR_SYMBOL(s)) {
-            LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_head;  // will fill in bookmark
+        else {
+            cp = STR_TAIL(s);
+            for (index = len; index != at; --index)
+                cp = BACK_STR(cp);
         }
-    }
-    else {
-        if (len < sizeof(REBVAL)) {
-            if (not IS_STR_SYMBOL(s))
-                assert(not bookmark);  // mutations must ensure this
-            goto scan_from_tail;  // good locality, avoid bookmark logic
-        }
-        if (not bookmark and not IS_STR_SYMBOL(s)) {
-            LINK(s).bookmarks = bookmark = Alloc_Bookmark();
-            goto scan_from_tail;  // will fill in bookmark
-        }
-    }
-
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
-    //
-    assert(not LINK(bookmark).bookmarks);  // only one for now
-
-  blockscope {
-    REBCNT booked = BMK_INDEX(bookmark);
-
-    if (at < booked / 2) {  // !!! when faster to seek from head?
-        bookmark = nullptr;
-        goto scan_from_head;
-    }
-    if (at > len - (booked / 2)) {  // !!! when faster to seek from tail?
-        bookmark = nullptr;
-        goto scan_from_tail;
-    }
-
-    index = booked;
-    cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + BMK_OFFSET(bookmark)); }
-
-    if (index > at)
-        goto scan_backward;
-
-    goto scan_forward;
-
-  scan_from_head:
-
-    cp = STR_HEAD(s);
-    index = 0;
-
-  scan_forward:
-
-    assert(index <= at);
-    for (; index != at; ++index)
-        cp = NEXT_STR(cp);
-
-    if (not bookmark)
-        return cp;
-
-    goto update_bookmark;
-
-  scan_from_tail:
-
-    cp = STR_TAIL(s);
-    index = len;
-
-  scan_backward:
-
-    assert(index >= at);
-    for (; index != at; --index)
-        cp = BACK_STR(cp);
-
-    if (not bookmark)
         return cp;
+    }
 
-  update_bookmark:
+  #if defined(DEBUG_SPORADICALLY_DROP_BOOKMARKS)
+    if (LINK(s).bookmarks and SPORADICALLY(100))
+        Free_Bookmarks_Maybe_Null(s);
+  #endif
 
-    BMK_INDEX(bookmark) = index;
-    BMK_OFFSET(bookmark) = cp - STR_HEAD(s);
+    cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + Find_Bookmarked_Offset(s, at));
 
   #if defined(DEBUG_VERIFY_STR_AT)
     REBCHR(*) check_cp = STR_HEAD(s);
@@ -659,6 +619,9 @@ inline static REBSTR *VAL_STRING(const REBCEL *v) {
     return STR(VAL_NODE(v));  // VAL_SERIES() would assert
 }
 
+inline static bool Is_String_Definitely_ASCII(const REBCEL *v)
+  { return Is_Definitely_Ascii(VAL_STRING(v)); }
+
 inline static REBCNT VAL_LEN_HEAD(const REBCEL *v) {
     if (REB_BINARY == CELL_KIND(v))
         return SER_USED(VAL_SERIES(v));  // binaries can alias strings...
@@ -771,21 +734,31 @@ inline static void SET_CHAR_AT(REBSTR *s, REBCNT n, REBUNI c) {
     // If the codepoint we are writing is the same size as the codepoint that
     // is already there, then we can just ues WRITE_CHR() and be done.
     //
-    REBCNT size_old = 1 + trailingBytesForUTF8[*cast(REBYTE*, cp)];
-    REBCNT size_new = Encoded_Size_For_Codepoint(c);
+    REBINT size_old = 1 + trailingBytesForUTF8[*cast(REBYTE*, cp)];
+    REBINT size_new = Encoded_Size_For_Codepoint(c);
+    REBCNT len = MISC(s).length;  // byte-level resizing corrupts it in debug
     if (size_new == size_old) {
         // common case... no memory shuffling needed
     }
     else if (size_old > size_new) {  // shuffle forward, not memcpy, overlaps!
         REBYTE *later = cast(REBYTE*, cp) + (size_old - size_new);
         memmove(cp, later, STR_TAIL(s) - later);  // not memcpy()!
+        SET_SERIES_USED(SER(s), SER_USED(SER(s)) - (size_old - size_new));
+        TERM_SEQUENCE(SER(s));
+        MISC(s).length = len;  // same number of codepoints
     }
     else {  // need backward, may need series expansion, not memcpy, overlaps!
-        EXPAND_SERIES_TAIL(SER(s), size_new - size_old);
+        REBSIZ offset = cast(REBYTE*, cp) - SER_DATA_RAW(SER(s));
+        EXPAND_SERIES_TAIL(SER(s), size_new - size_old);  // may reallocate
+        MISC(s).length = len;  // same number of codepoints
+        cp = cast(REBCHR(*), SER_DATA_RAW(SER(s)) + offset);
         REBYTE *later = cast(REBYTE*, cp) + (size_new - size_old);
-        memmove(cp, later, STR_TAIL(s) - later);  // not memcpy()!
+        memmove(later, cp, STR_TAIL(s) - later);  // not memcpy()!
     }
 
+    if (size_new != size_old and LINK(s).bookmarks)
+        Update_Bookmarks(s, n, 1, 1, size_new - size_old);
+
     WRITE_CHR(cp, c);
 }
 
@@ -841,17 +814,6 @@ inline static REBSTR *Make_Sized_String_UTF8(const char *utf8, size_t size) {
 inline static REBINT Hash_String(REBSTR *str)
     { return Hash_UTF8(STR_HEAD(str), STR_SIZE(str)); }
 
-inline static REBINT First_Hash_Candidate_Slot(
-    REBCNT *skip_out,
-    REBCNT hash,
-    REBCNT num_slots
-){
-    *skip_out = (hash & 0x0000FFFF) % num_slots;
-    if (*skip_out == 0)
-        *skip_out = 1;
-    return (hash & 0x00FFFF00) % num_slots;
-}
-
 
 //=//// REBSTR COPY HELPERS ///////////////////////////////////////////////=//
 
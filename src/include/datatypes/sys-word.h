@@ -63,7 +63,7 @@
 #define LINK_KEYSOURCE(s)       LINK(s).custom.node
 
 #define INIT_LINK_KEYSOURCE(a,keysource) \
-    LINK_KEYSOURCE(a) = (keysource)  // helpful macro for injecting debugging
+    (Remember_Series(SER(a)), LINK_KEYSOURCE(a) = (keysource))  // debug hook
 
 
 // For a *read-only* REBSTR, circularly linked list of othEr-CaSed string
@@ -34,11 +34,19 @@
 
 // Linked list of used memory segments
 //
+// Segments may have different numbers of nodes (see Fill_Pool()), so loops
+// over a pool's nodes must use the segment's `units`, not the pool's.
+//
 typedef struct rebol_mem_segment {
     struct rebol_mem_segment *next;
     uintptr_t size;
+    uintptr_t units; // number of nodes in this segment
+    uintptr_t flags; // SEG_FLAG_XXX
 } REBSEG;
 
+#define SEG_FLAG_MAPPED 0x1 // mmap()'d huge page, not from ALLOC_N()
+#define SEG_FLAG_RELEASE 0x2 // being freed by Release_Free_Segments()
+
 
 // Specifies initial pool sizes
 //
@@ -58,8 +66,38 @@ struct rebol_mem_pool {
     REBCNT units; // units per segment allocation
     REBCNT free; // number of units remaining
     REBCNT  has; // total number of units
+
+    // Histogram of series data allocations (only kept while PG_Pool_Tuning)
+    //
+    REBU64 requests; // allocations served by this pool
+    REBU64 wasted; // bytes of those allocations that weren't asked for
 };
 
+// Make_Node() takes nodes from a small "magazine" of free nodes for each
+// pool, which Refill_Magazine() fills MEM_MAGAZINE_SIZE nodes at a time from
+// the pool's free list.  In release builds, freed nodes also go to it, and
+// Flush_Magazine() gives back MEM_MAGAZINE_SIZE when it gets to twice that.
+// So the common case of allocating and freeing is a push or pop on a short
+// singly linked list, and the pool's list is only touched in batches.
+//
+// !!! This is just a batching free list.  TVAR is a plain global, so there
+// is one set of magazines, and they are no help to threads (none of which
+// allocate nodes today, the pools aren't safe for that).  If TVAR became
+// thread-local they could be per-thread caches...but Refill_Magazine() and
+// Flush_Magazine() would need a lock, and so would Fill_Pool() and the sweep.
+//
+// The nodes in a magazine are still FREED_SERIES_BYTE nodes, but they aren't
+// counted in the pool's `free` (which is the length of its free list).  So
+// anything reporting how much of a pool is free has to add `count` to it,
+// and Dump_Pools() and STATS/POOLS show it.
+//
+typedef struct rebol_mem_magazine {
+    REBNOD *first;
+    REBCNT count;
+} REBMAG;
+
+#define MEM_MAGAZINE_SIZE 32
+
 #define DEF_POOL(size, count) {size, count}
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
@@ -68,6 +106,43 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+// After each recycle the ballast is set to MEM_GROWTH_PERCENT of the memory
+// still in use (but no less than MEM_BALLAST, or what RECYCLE/BALLAST set).
+// If MEM_SURVIVAL_HIGH percent or more of what was allocated since the prior
+// recycle survived, the ballast is doubled.  See Update_Ballast().
+//
+#define MEM_GROWTH_PERCENT 100
+#define MEM_SURVIVAL_HIGH 90
+
+// Generational recycling logs newly managed series in a "nursery" so that a
+// minor recycle can sweep just those.  When the nursery fills, a recycle is
+// signaled.  Every so many minor recycles a full one is done, so garbage
+// which survived into the old generation is eventually reclaimed.
+//
+#define MEM_NURSERY_SIZE 32768
+#define MEM_MINORS_PER_FULL 8
+
+// After a full recycle, segments with no nodes in use are released, but each
+// pool keeps free nodes adding up to at least MEM_RETAIN_PERCENT of those in
+// use (RECYCLE/RETAIN changes it).  See Release_Free_Segments().
+//
+#define MEM_RETAIN_PERCENT 50
+
+// If built with USE_WORKER_THREADS, finding and releasing the garbage in the
+// series pool is split up among threads (one per CPU, up to a limit), which
+// are kept waiting between recycles.  Each thread gets at least
+// MEM_SWEEP_MIN_SEGS segments, so small heaps are swept serially.
+//
+#define MEM_SWEEP_MAX_THREADS 16
+#define MEM_SWEEP_MIN_SEGS 8
+
+// With pool tuning on (RECYCLE/TUNE), each segment a pool gets is as big as
+// all the ones it has so far, up to MEM_HUGE_PAGE_SIZE.  Segments of that
+// size are mapped as transparent huge pages if the platform HAS_HUGE_PAGES,
+// so big heaps need fewer TLB entries.
+//
+#define MEM_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
@@ -167,6 +167,11 @@ Special internal defines used by RT, not Host-Kit developers:
     // ...at the top of the file.
 
     #define PROC_EXEC_PATH "/proc/self/exe"
+
+    // Memory pool segments can be mmap()'d and madvise()'d to be backed by
+    // transparent huge pages, see Fill_Pool().
+    //
+    #define HAS_HUGE_PAGES
 #endif
 
 
@@ -355,6 +360,15 @@ Special internal defines used by RT, not Host-Kit developers:
     #define DEBUG_BOOKMARKS_ON_MODIFY  // main routine for preserving marks
 #endif
 
+// All-ASCII strings skip the bookmarks, and are indexed by byte.  Defining
+// DEBUG_UTF8_NO_ASCII_SHORTCUT makes every string go the non-ASCII way.
+// DEBUG_UTF8_EVERYWHERE doesn't imply it, so that build still tests the
+// ASCII fast paths which most strings take.
+//
+#if 0
+    #define DEBUG_UTF8_NO_ASCII_SHORTCUT
+#endif
+
 #ifdef __SANITIZE_ADDRESS__
     #ifdef CPLUSPLUS_11
         //
@@ -128,6 +128,10 @@
 // is at MAKE-time, o3 put its binding into any functions bound to o2 or o1,
 // thus getting its overriding behavior.
 //
+// Since this is asked on every fetch of a word in a method body, the answer
+// for a pair of keylists other than the same one is cached, see notes on
+// `struct Reb_Override_Cache`.
+//
 inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
 {
     REBNOD *stored_source = LINK_KEYSOURCE(stored);
@@ -149,9 +153,34 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
     if (temp->header.bits & ARRAY_FLAG_IS_PARAMLIST)
         return false;
 
+    if (temp == stored_source)  // e.g. instances that didn't add any fields
+        return true;
+
+    struct Reb_Override_Cache *entry = &TG_Override_Cache[
+        (
+            (cast(uintptr_t, stored_source) >> 4) * 31
+                + (cast(uintptr_t, temp) >> 4)
+        ) & (OVERRIDE_CACHE_SIZE - 1)
+    ];
+    if (
+        entry->stored == stored_source
+        and entry->override == temp
+        and entry->shape == TG_Shape_Version
+    ){
+        return entry->overrides;
+    }
+
+    entry->stored = stored_source;
+    entry->override = temp;
+    entry->shape = TG_Shape_Version;
+    stored_source->header.bits |= KEYLIST_FLAG_OVERRIDE_CACHED;
+    temp->header.bits |= KEYLIST_FLAG_OVERRIDE_CACHED;
+
     while (true) {
-        if (temp == stored_source)
+        if (temp == stored_source) {
+            entry->overrides = true;
             return true;
+        }
 
         if (LINK_ANCESTOR_NODE(temp) == temp)
             break;
@@ -159,6 +188,7 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
         temp = LINK_ANCESTOR_NODE(temp);
     }
 
+    entry->overrides = false;
     return false;
 }
 
@@ -408,7 +438,7 @@ inline static void INIT_BINDING_MAY_MANAGE(RELVAL *out, REBNOD* binding) {
         // no luck...`out` might outlive the binding, must manage
     }
 
-    binding->header.bits |= NODE_FLAG_MANAGED; // burdens the GC, now...
+    Manage_Untracked_Series(SER(binding)); // burdens the GC, now...
     EXTRA(Binding, out).node = binding;
 }
 
@@ -771,47 +801,36 @@ inline static REBSPC *Derive_Specifier(REBSPC *parent, const REBCEL *item) {
 //
 // BINDING CONVENIENCE MACROS
 //
-// WARNING: Don't pass these routines something like a singular REBVAL* (such
-// as a REB_BLOCK) which you wish to have bound.  You must pass its *contents*
-// as an array...as the plural "values" in the name implies!
-//
-// So don't do this:
-//
-//     REBVAL *block = ARG(block);
-//     REBVAL *something = ARG(next_arg_after_block);
-//     Bind_Values_Deep(block, context);
-//
-// What will happen is that the block will be treated as an array of values
-// and get incremented.  In the above case it would reach to the next argument
-// and bind it too (likely crashing at some point not too long after that).
+// These take the array and the index of the first value to bind, e.g.:
 //
-// Instead write:
+//     Bind_Values_Deep(VAL_ARRAY(block), VAL_INDEX(block), context);
 //
-//     Bind_Values_Deep(VAL_ARRAY_HEAD(block), context);
+// There's no length limit.  So although you can control where it starts, it
+// will keep binding until it hits an end marker.
 //
-// That will pass the address of the first value element of the block's
-// contents.  You could use a later value element, but note that the interface
-// as written doesn't have a length limit.  So although you can control where
-// it starts, it will keep binding until it hits an end marker.
+// (They used to take a RELVAL* to the first value, which made it easy to pass
+// a singular REBVAL like a REB_BLOCK by mistake.  Taking the array also lets
+// Bind_Values_Core() run the write barrier on it, see Remember_Series().)
 //
 
-#define Bind_Values_Deep(values,context) \
-    Bind_Values_Core((values), (context), TS_WORD, 0, BIND_DEEP)
+#define Bind_Values_Deep(array,index,context) \
+    Bind_Values_Core((array), (index), (context), TS_WORD, 0, BIND_DEEP)
 
-#define Bind_Values_All_Deep(values,context) \
-    Bind_Values_Core((values), (context), TS_WORD, TS_WORD, BIND_DEEP)
+#define Bind_Values_All_Deep(array,index,context) \
+    Bind_Values_Core((array), (index), (context), TS_WORD, TS_WORD, BIND_DEEP)
 
-#define Bind_Values_Shallow(values, context) \
-    Bind_Values_Core((values), (context), TS_WORD, 0, BIND_0)
+#define Bind_Values_Shallow(array,index,context) \
+    Bind_Values_Core((array), (index), (context), TS_WORD, 0, BIND_0)
 
 // Gave this a complex name to warn of its peculiarities.  Calling with
 // just BIND_SET is shallow and tricky because the set words must occur
 // before the uses (to be applied to bindings of those uses)!
 //
-#define Bind_Values_Set_Midstream_Shallow(values, context) \
+#define Bind_Values_Set_Midstream_Shallow(array,index,context) \
     Bind_Values_Core( \
-        (values), (context), TS_WORD, FLAGIT_KIND(REB_SET_WORD), BIND_0)
+        (array), (index), (context), \
+        TS_WORD, FLAGIT_KIND(REB_SET_WORD), BIND_0)
 
-#define Unbind_Values_Deep(values) \
-    Unbind_Values_Core((values), nullptr, true)
+#define Unbind_Values_Deep(array,index) \
+    Unbind_Values_Core((array), (index), nullptr, true)
 
@@ -231,6 +231,62 @@ inline static bool Did_Init_Inert_Optimize_Complete(
 }
 
 
+// Arguments are very often plain WORD!s holding a non-ACTION! value, as in
+// `x + 1` or `append data item` inside a loop.  Pushing a frame to fetch
+// them is mostly overhead, but just as with inert values the frame can't be
+// skipped if what follows could be enfix.  Unlike the inert case, a left
+// quoting enfix function would have wanted the word itself--so the check is
+// made before the variable is fetched, and can only be done if the next
+// cell is already known (the feed is on an array, not a va_list).
+//
+// !!! Caching which positions in a block are "plain variable fetch" would
+// save the lookahead test too, but variables can be changed to hold enfix
+// actions with no write barrier to invalidate such a cache.  So the facts
+// are rechecked each time, which only costs a lookup the evaluator would
+// have done anyway--and that is left in `feed->gotten` for it.
+//
+inline static bool Did_Init_Word_Optimize_Complete(
+    REBVAL *out,
+    struct Reb_Feed *feed
+){
+    if (KIND_BYTE_UNCHECKED(feed->value) != REB_WORD or not OPTIMIZATIONS_OK)
+        return false;
+
+    const RELVAL *lookahead = feed->pending;
+    if (IS_END(lookahead) and feed->vaptr)
+        return false;  // next item comes from the va_list, can't peek at it
+
+    const REBVAL *var = feed->gotten
+        ? feed->gotten
+        : Try_Get_Opt_Var(feed->value, feed->specifier);
+    if (not var or IS_ACTION(var) or IS_NULLED_OR_VOID(var))
+        return false;  // run the action (or give the error) in a frame
+
+    const REBVAL *lookahead_gotten = nullptr;
+    if (NOT_END(lookahead)) {
+        if (KIND_BYTE_UNCHECKED(lookahead) == REB_PATH)
+            return false;  // might be `/`, let evaluator sort it out
+
+        if (KIND_BYTE_UNCHECKED(lookahead) == REB_WORD) {
+            lookahead_gotten = Try_Get_Opt_Var(lookahead, feed->specifier);
+            if (
+                lookahead_gotten
+                and IS_ACTION(lookahead_gotten)
+                and GET_ACTION_FLAG(VAL_ACTION(lookahead_gotten), ENFIXED)
+            ){
+                return false;  // enfix may quote the word, or take the value
+            }
+        }
+    }
+
+    Move_Value(out, var);  // no copy CELL_FLAG_UNEVALUATED
+    (void)(Fetch_Next_In_Feed(feed, false));
+    feed->gotten = lookahead_gotten;
+    CLEAR_FEED_FLAG(feed, NO_LOOKAHEAD);
+    return true;
+}
+
+
 // This is a very light wrapper over Eval_Core(), which is used with
 // operations like ANY or REDUCE that wish to perform several successive
 // operations on an array, without creating a new frame each time.
@@ -268,6 +324,13 @@ inline static bool Eval_Step_In_Subframe_Throws(
     if (Did_Init_Inert_Optimize_Complete(out, f->feed, &flags))
         return false;  // If eval not hooked, ANY-INERT! may not need a frame
 
+    if (
+        not (flags & EVAL_FLAG_POST_SWITCH)
+        and Did_Init_Word_Optimize_Complete(out, f->feed)
+    ){
+        return false;  // nor may a WORD! that's just fetching a variable
+    }
+
     // Can't SET_END() here, because sometimes it would be overwriting what
     // the optimization produced.  Trust that it has already done it if it
     // was necessary.
@@ -244,12 +244,28 @@ inline static const RELVAL *Detect_Feed_Pointer_Maybe_Fetch(
         feed->context = Get_Context_From_Stack();
         feed->lib = (feed->context != Lib_Context) ? Lib_Context : nullptr;
 
+        feed->specifier = SPECIFIED;
+
+        // A lone fragment that was cached with nothing to copy is walked in
+        // place, without making an array.  See Cached_Va_Array().
+        //
+        REBARR *cached = Cached_Va_Array(feed, cast(const REBYTE*, p));
+        if (cached) {
+            feed->vaptr = nullptr;  // the end was taken from the va_list
+
+            feed->value = ARR_HEAD(cached);
+            feed->pending = feed->value + 1;  // may be END
+            feed->array = cached;
+            feed->index = 1;
+
+            CLEAR_CELL_FLAG(&feed->fetched, FETCHED_MARKED_TEMPORARY);
+            break;
+        }
+
         struct Reb_Binder binder;
         Init_Interning_Binder(&binder, feed->context);
         feed->binder = &binder;
 
-        feed->specifier = SPECIFIED;
-
         SCAN_STATE ss;
         const REBLIN start_line = 1;
         Init_Va_Scan_State_Core(
@@ -260,7 +276,10 @@ inline static const RELVAL *Detect_Feed_Pointer_Maybe_Fetch(
             feed
         );
 
-        REBVAL *error = rebRescue(cast(REBDNG*, &Scan_To_Stack), &ss);
+        // Fragments seen before may come from the scan cache, though their
+        // words still need the binder if they weren't cached yet.
+        //
+        REBVAL *error = rebRescue(cast(REBDNG*, &Scan_Va_To_Stack), &ss);
         Shutdown_Interning_Binder(&binder, feed->context);
 
         if (error) {
@@ -51,7 +51,7 @@ PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 // according to the total number of canons in the system.
 //
 PVAR REBSER *PG_Symbol_Canons; // Canon symbol pointers for words in %words.r
-PVAR REBSER *PG_Canons_By_Hash; // Canon REBSER pointers indexed by hash
+PVAR REBSER *PG_Canons_By_Hash; // Canon REBSER pointers (and hashes)
 PVAR REBCNT PG_Num_Canon_Slots_In_Use; // Total canon hash slots (+ deleteds)
 #if !defined(NDEBUG)
     PVAR REBCNT PG_Num_Canon_Deleteds; // Deleted canon hash slots "in use"
@@ -68,6 +68,7 @@ PVAR REBUNI *Lower_Cases;
 
 // Other:
 PVAR REBYTE *PG_Pool_Map;   // Memory pool size map (created on boot)
+PVAR bool PG_Pool_Tuning;   // Size segments by demand, keep histogram
 
 PVAR REB_OPTS *Reb_Opts;
 
@@ -178,11 +179,31 @@ TVAR REBI64 TG_Max_Ballast;
 
 //-- Memory and GC:
 TVAR REBPOL *Mem_Pools;     // Memory pool array
+TVAR REBMAG *TG_Magazines; // Batches of free nodes for each pool (REBMAG)
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
+TVAR REBCNT GC_Growth; // ballast as percent of live memory, 0 means fixed
+TVAR REBU64 GC_Live_Bytes; // memory in use after the last recycle
+TVAR REBCNT GC_Survival; // percent of memory allocated that survived recycle
+TVAR REBCNT GC_Retain; // free pool nodes kept, as percent of the ones in use
+TVAR REBU64 GC_Released; // bytes of pool segments released by recycles
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBSER *GC_Nursery; // Series managed since last recycle (if generational)
+TVAR bool GC_Generational; // false if RECYCLE/GENERATIONAL turns it off
+TVAR bool GC_Old_Known; // last recycle set SERIES_INFO_SCANNED on survivors
+TVAR REBSER *GC_Remembered; // Scanned series written since (write barrier)
+TVAR REBSER *GC_Minor_Marks; // Nodes a minor recycle marked, to unmark after
+TVAR bool GC_Any_Scanned; // SERIES_INFO_SCANNED may be set on some series
+TVAR bool GC_Minor; // true while a minor (nursery-only) recycle is running
+TVAR REBCNT GC_Minor_Count; // minor recycles run since the last full one
+TVAR REBCNT GC_Mark_Budget; // arrays per incremental marking step (0 is off)
+TVAR bool GC_Marking; // true between the steps of an incremental recycle
+TVAR bool GC_Finishing; // incremental recycle's final pause is marking
+TVAR REBSER *GC_Reached_Pairings; // Pairings to mark in that final pause
+TVAR REBSER *GC_Sweep_Bits; // garbage found in a segment by a serial sweep
+TVAR REBCNT GC_Sweep_Threads; // most threads to split a sweep across
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
@@ -222,6 +243,13 @@ TVAR struct Reb_Feed TG_Frame_Feed_End;
 //
 TVAR REBARR *TG_Reuse;
 
+TVAR uintptr_t TG_Shape_Version; // see Is_Overriding_Context()
+TVAR struct Reb_Override_Cache TG_Override_Cache[OVERRIDE_CACHE_SIZE];
+TVAR struct Reb_Key_Cache TG_Key_Cache[KEY_CACHE_SIZE];
+TVAR struct Reb_Parse_Program TG_Parse_Programs[PARSE_PROGRAM_CACHE_SIZE];
+TVAR uintptr_t TG_Parse_Program_Tick; // for LRU in TG_Parse_Programs
+TVAR struct Reb_Scan_Cache TG_Scan_Cache[SCAN_CACHE_SIZE];
+
 //-- Evaluation stack:
 TVAR REBARR *DS_Array;
 TVAR REBDSP DS_Index;
@@ -85,19 +85,15 @@
 //
 inline static void *Make_Node(REBCNT pool_id)
 {
-    REBPOL *pool = &Mem_Pools[pool_id];
-    if (not pool->first) // pool has run out of nodes
-        Fill_Pool(pool); // refill it
-
-    assert(pool->first);
-
-    REBNOD *node = pool->first;
+    REBMAG *mag = &TG_Magazines[pool_id];
+    if (mag->count == 0)  // take a batch from the pool (filling it if empty)
+        Refill_Magazine(pool_id);
 
-    pool->first = node->next_if_free;
-    if (node == pool->last)
-        pool->last = nullptr;
+    assert(mag->first);
 
-    pool->free--;
+    REBNOD *node = mag->first;
+    mag->first = node->next_if_free;
+    --mag->count;
 
   #ifdef DEBUG_MEMORY_ALIGN
     if (cast(uintptr_t, node) % sizeof(REBI64) != 0) {
@@ -106,9 +102,9 @@ inline static void *Make_Node(REBCNT pool_id)
             cast(void*, node),
             cast(int, sizeof(REBI64))
         );
-        printf("Pool address is %p and pool-first is %p\n",
-            cast(void*, pool),
-            cast(void*, pool->first)
+        printf("Pool address is %p and magazine-first is %p\n",
+            cast(void*, &Mem_Pools[pool_id]),
+            cast(void*, mag->first)
         );
         panic (node);
     }
@@ -142,12 +138,15 @@ inline static void Free_Node(REBCNT pool_id, REBNOD *node)
 
     mutable_FIRST_BYTE(node->header) = FREED_SERIES_BYTE;
 
-    REBPOL *pool = &Mem_Pools[pool_id];
-
   #ifdef NDEBUG
-    node->next_if_free = pool->first;
-    pool->first = node;
+    REBMAG *mag = &TG_Magazines[pool_id];
+    node->next_if_free = mag->first;
+    mag->first = node;
+    if (++mag->count >= 2 * MEM_MAGAZINE_SIZE)
+        Flush_Magazine(pool_id);
   #else
+    REBPOL *pool = &Mem_Pools[pool_id];
+
     // !!! In R3-Alpha, the most recently freed node would become the first
     // node to hand out.  This is a simple and likely good strategy for
     // cache usage, but makes the "poisoning" nearly useless.
@@ -165,9 +164,9 @@ inline static void Free_Node(REBCNT pool_id, REBNOD *node)
     pool->last->next_if_free = node;
     pool->last = node;
     node->next_if_free = nullptr;
-  #endif
 
     pool->free++;
+  #endif
 }
 
 
@@ -194,6 +194,62 @@ STATIC_ASSERT(ARRAY_FLAG_CONST_SHALLOW == CELL_FLAG_CONST);
 #define LINK_FILE(s)            STR(LINK_FILE_NODE(s))
 
 
+// PARSE keeps a "program" for rule arrays that are deeply frozen, so it can
+// skip to the next `|` alternate without walking the cells in between, and
+// skip alternates that can't start with the input's next character.  It
+// is only made for frozen arrays, since there's no hook to see when other
+// arrays are modified.  A program is freed by Decay_Series() when its array
+// is, so that a new array at the same address doesn't get its program.
+//
+// Programs are cached in sets of PARSE_PROGRAM_CACHE_WAYS picked by address.
+// An array that misses replaces the least recently used program in its set,
+// so a few rule arrays landing in the same set don't keep rebuilding.
+//
+struct Reb_Parse_Program {
+    REBARR *rules;
+    uintptr_t used;  // TG_Parse_Program_Tick when last gotten
+    REBCNT len;
+    REBCNT *alternates;  // index of first `|` (or tail) at or after each cell
+    REBYTE *firsts;  // PARSE_FIRST_SIZE bitmap per cell, see Init_Parse_First
+    struct Reb_Searcher *searchers[2];  // for TO and THRU, [0] is /CASE
+};
+
+#define PARSE_PROGRAM_CACHE_SIZE 256  // must be a power of 2
+#define PARSE_PROGRAM_CACHE_WAYS 4  // must be a power of 2
+
+// A bit for each byte which could start a match, and one more bit for any
+// codepoint that isn't ASCII (when the input is a string, not a binary).
+//
+#define PARSE_FIRST_NON_ASCII 256
+#define PARSE_FIRST_SIZE ((PARSE_FIRST_NON_ASCII / 8) + 1)
+
+// A searcher is an Aho-Corasick automaton, for finding the first place any
+// of several TEXT! or BINARY! patterns occur in one pass over the input.
+// SEARCHER makes them as HANDLE!s for FIND-ANY, and PARSE makes them for TO
+// and THRU with blocks of TEXT! alternates.  See Make_Searcher().
+//
+struct Reb_Searcher {
+    bool uncase;  // patterns are lowercased, and so is input when searched
+    bool whole_chars;  // no BINARY! pattern has a partial UTF-8 character
+    REBCNT num_patterns;
+    REBSIZ *sizes;  // bytes in each (lowercased) pattern
+    REBCNT *lens;  // codepoints in each pattern
+
+    REBCNT classes[256];  // bytes in no pattern are class 0
+    REBCNT num_classes;
+    REBCNT max_states;  // size the state arrays were allocated with
+    REBCNT *next;  // state to go to, for each state and class of byte
+    REBCNT *depth;  // bytes matched by each state
+    REBINT *output;  // pattern matched when a state is reached, or -1
+    REBCNT *dict;  // next state on a state's failure chain with an output
+};
+
+// PARSE only makes searchers for TO and THRU on blocks that aren't deeply
+// frozen (so can't be kept) if they have at least this many alternates.
+//
+#define PARSE_SEARCHER_MIN 8
+
+
 #if !defined(DEBUG_CHECK_CASTS)
 
     #define ARR(p) \
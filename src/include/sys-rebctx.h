@@ -44,6 +44,50 @@ struct Reb_Context {
 };
 
 
+// Is_Overriding_Context() is asked if one keylist derives from another for
+// every fetch of a word in a METHOD body, and it walks the ancestor links to
+// find out.  This direct-mapped cache keeps the answers.  A keylist's
+// ancestor never changes after INIT_LINK_ANCESTOR(), so making new keylists
+// doesn't invalidate anything.  But a freed keylist's node may be reused for
+// a new one, so freeing a keylist the cache has an answer about bumps a
+// "shape version" (TG_Shape_Version), which invalidates everything cached
+// before.  So does expanding a keylist or hiding one of its keys.
+//
+struct Reb_Override_Cache {
+    REBNOD *stored;  // keysource of the context the word is bound to
+    REBNOD *override;  // keysource of the binding of the running action
+    uintptr_t shape;  // TG_Shape_Version when this was cached
+    bool overrides;
+};
+
+#define OVERRIDE_CACHE_SIZE 64  // must be a power of 2
+
+
+//=//// KEYLIST_FLAG_OVERRIDE_CACHED //////////////////////////////////////=//
+//
+// Set on a keylist when Is_Overriding_Context() caches an answer about it,
+// so Decay_Series() knows freeing it has to bump TG_Shape_Version.  (Keylists
+// aren't varlists or paramlists, so they can use an array subclass flag.)
+//
+#define KEYLIST_FLAG_OVERRIDE_CACHED \
+    ARRAY_FLAG_23
+
+
+// Path picks like `obj/field` find the field's index with a linear search
+// of the keylist.  Find_Canon_In_Context_Cached() remembers the index found
+// for a keylist and name.  An entry is checked by seeing if the key at that
+// index still has the name (keys are unique and don't move), so there's no
+// need to invalidate anything when keylists are expanded, freed or reused.
+//
+struct Reb_Key_Cache {
+    REBNOD *keylist;
+    REBSTR *canon;
+    REBCNT index;
+};
+
+#define KEY_CACHE_SIZE 256  // must be a power of 2
+
+
 #if !defined(DEBUG_CHECK_CASTS)
 
     #define CTX(p) \
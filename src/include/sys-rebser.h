@@ -468,15 +468,35 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_SCANNED ///////////////////////////////////////////////=//
 //
-#define SERIES_INFO_29 \
+// Set on managed series which survived a recycle while generational mode was
+// on (the "old" generation).  A minor recycle takes it that what an old
+// series refers to was accounted for already, so marking stops there...and
+// it won't look inside again unless the series is written to (see below).
+//
+// This is kept apart from NODE_FLAG_MARKED, which must be clear on every
+// series while evaluation is running (e.g. Expand_Series() asserts this).
+//
+// While an incremental recycle is running, it instead means that one of its
+// steps has looked into the series (see Queue_Mark_Node_Deep()).
+//
+#define SERIES_INFO_SCANNED \
     FLAG_LEFT_BIT(29)
 
 
-//=//// SERIES_INFO_30 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_REMEMBERED ////////////////////////////////////////////=//
+//
+// Remember_Series() is the write barrier, and it sets this when a series
+// which is SERIES_INFO_SCANNED gets changed.  The series is then in the
+// GC_Remembered list, whose contents are rescanned by the next recycle in
+// case they now refer to young series.  The bit keeps it from being added
+// to the list more than once.
+//
+// An incremental recycle also sets it on arrays waiting in the mark stack,
+// which aren't SERIES_INFO_SCANNED yet (so the write barrier ignores them).
 //
-#define SERIES_INFO_30 \
+#define SERIES_INFO_REMEMBERED \
     FLAG_LEFT_BIT(30)
 
 
@@ -631,8 +651,9 @@ union Reb_Series_Link {
     // by character, to turn an index into an offset.  This is prohibitive.
     //
     // These bookmarks must be kept in sync.  How many bookmarks are kept
-    // should be reigned in proportionally to the length of the series.  As
-    // a first try of this strategy, singular arrays are being used.
+    // is reigned in proportionally to the length of the series: an array
+    // holds the last access, plus a sparse index of about one per 1K
+    // codepoints in the parts of the string that have been accessed.
     //
     REBBMK *bookmarks;
 
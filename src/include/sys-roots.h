@@ -97,7 +97,7 @@ inline static bool Is_Action_Frame_Fulfilling(REBFRM *f) {
 //
 inline static REBCTX *Context_For_Frame_May_Manage(REBFRM *f) {
     assert(not Is_Action_Frame_Fulfilling(f));
-    SET_SERIES_FLAG(f->varlist, MANAGED);
+    Manage_Untracked_Series(SER(f->varlist));
     return CTX(f->varlist);
 }
 
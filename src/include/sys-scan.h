@@ -291,6 +291,28 @@ typedef struct rebol_scan_state {
     REBFLGS opts;
 } SCAN_STATE;
 
+// The variadic API (rebValue() and friends) scans UTF-8 fragments each time
+// they're passed.  C code tends to pass the same string literals over and
+// over, so what a fragment scanned to is cached by its address and by the
+// context its words were bound into.  The bytes are saved as well, in case
+// the address is reused for different text.  A fragment is only scanned on
+// its own (and cached) the second time it is seen.  See the notes on
+// Did_Push_Cached_Fragment() and Cached_Va_Array().
+//
+struct Reb_Scan_Cache {
+    const REBYTE *utf8;  // address of the fragment, nullptr if unused
+    REBCTX *context;  // feed context the fragment was seen with
+    REBYTE *bytes;  // copy of the fragment, to check it hasn't changed
+    REBSIZ size;
+    REBARR *array;  // managed, nullptr if the fragment was only seen once
+    REBCNT lines;  // newlines in the fragment, to keep the line count right
+    bool newline_pending;  // fragment ended with a newline
+    bool uncacheable;  // fragment doesn't scan on its own, e.g. `"[" "]"`
+    bool shared;  // array is frozen and has no series to clone for each use
+};
+
+#define SCAN_CACHE_SIZE 64  // must be a power of 2
+
 #define ANY_CR_LF_END(c) ((c) == '\0' or (c) == CR or (c) == LF)
 
 enum {
@@ -298,7 +320,8 @@ enum {
     SCAN_FLAG_ONLY = 1 << 1, // only single value (no blocks)
     SCAN_FLAG_RELAX = 1 << 2, // no error throw
     SCAN_FLAG_NULLEDS_LEGAL = 1 << 3, // NULL splice in top level of rebValue()
-    SCAN_FLAG_LOCK_SCANNED = 1 << 4  // lock series as they are loaded
+    SCAN_FLAG_LOCK_SCANNED = 1 << 4, // lock series as they are loaded
+    SCAN_FLAG_FRAGMENT = 1 << 5 // stop at end of the variadic UTF-8 fragment
 };
 
 
@@ -509,3 +509,235 @@
 
 
 (did parse "a" [some [to end] end])
+
+; Frozen rule blocks get a program to jump between alternates, which must
+; agree with how unfrozen rules walk to the next `|`.
+(
+    keywords: lock [
+        "alpha" (n: 1) | "beta" (n: 2) | "gamma" "x" (n: 3)
+        | "gamma" (n: 4) | [some "d"] (n: 5)
+    ]
+    did all [
+        parse "alpha" [keywords end] n = 1
+        parse "gamma" [keywords end] n = 4
+        parse "gammax" [keywords end] n = 3
+        parse "ddd" [keywords end] n = 5
+        not parse "delta" [keywords end]
+        parse "beta" lock ["a" | "b" skip "t" "a" end]
+    ]
+)
+
+; More frozen rule blocks than programs can be cached, used in turn, so some
+; share cache sets and replace each other's programs.
+(
+    blocks: copy []
+    repeat i 300 [
+        append/only blocks lock compose ["x" | (to text! i) | "y"]
+    ]
+    ok: true
+    loop 2 [
+        repeat i 300 [
+            rule: blocks/:i
+            if not parse to text! i [rule end] [ok: false]
+            if parse "z" [rule end] [ok: false]
+        ]
+    ]
+    ok
+)
+
+; Alternates of frozen rules whose first rule can't match the next character
+; or byte are skipped, which must not change the result.  (KELVIN SIGN U+212A
+; lowercases to "k", so ASCII and non-ASCII rules may match each other.)
+(
+    rules: [
+        "if" (k: 'if) | #"e" "lse" (k: 'else) | ws "hile" (k: 'while)
+        | "été" (k: 'summer) | #{FF} (k: 'byte) | "kelvin" (k: 'kelvin)
+        | "^(212A)m" (k: 'km) | (k: 'none) "x"
+    ]
+    change find rules 'ws charset "wW"  ; a BITSET! rule, not a WORD!
+    lock rules
+    did all [
+        parse "IF" [rules end] k = 'if
+        parse "else" [rules end] k = 'else
+        parse "While" [rules end] k = 'while
+        parse "ÉTÉ" [rules end] k = 'summer
+        parse "^(212A)elvin" [rules end] k = 'kelvin
+        parse "KM" [rules end] k = 'km
+        parse "x" [rules end] k = 'none
+        parse #{FF} [rules end] k = 'byte
+        not parse/case "IF" [rules end]
+        not parse "q" [rules end]
+    ]
+)
+
+; PARSE/MEMO reuses the result of a rule block retried at the same position,
+; so its GROUP!s don't run again.
+(
+    n: 0
+    a: [(n: n + 1) "a"]
+    did all [
+        parse/memo "ab" [a "x" | a "b"]
+        n = 1
+        parse "ab" [a "x" | a "b"]
+        n = 3
+    ]
+)
+(
+    digit: charset "0123456789"
+    expr: [term "+" expr | term "-" expr | term]
+    term: [factor "*" term | factor]
+    factor: ["(" expr ")" | some digit]
+    did all [
+        parse/memo "1+2*(3-4)*((5))" [expr end]
+        not parse/memo "1+2*(3-4" [expr end]
+        parse/memo text: "1+2" [digit remove "+" expr end]
+        text = "12"
+    ]
+)
+
+; A rule block that changes the input isn't remembered, as the position it
+; was tried at doesn't mean the same thing afterward.
+(
+    a: [remove "a"]
+    did all [
+        not parse/memo text: "ab" [a "x" | a "b"]
+        text = "b"
+    ]
+)
+
+; Results are remembered by the address of the rule block, so a block that
+; is let go of during the PARSE must not be freed.  Otherwise a new block at
+; its address would get its results.
+(
+    did parse/memo "ac" [
+        (r: copy ["a" "b"]) r
+        | (r: _ recycle r: copy ["a" "c"]) r
+    ]
+)
+
+; PARSE of a PORT! reads it a chunk at a time, and drops input which the
+; rules are done with.
+(
+    file: %parse-stream-test.txt
+    write file append/dup copy "" "line^/" 50000
+    n: 0
+    port: open file
+    ok: did parse port [some [thru newline (n: n + 1)] end]
+    close port
+    delete file
+    did all [ok  n = 50000]
+)
+
+; A stream much bigger than the buffer (PARSE_STREAM_CHUNK is 64K) gives the
+; same results as if it were all parsed at once.
+(
+    file: %parse-stream-test.txt
+    data: copy ""
+    repeat i 200000 [append data unspaced [i newline]]
+    write file data
+    sum: 0
+    last-num: _
+    port: open file
+    ok: did parse port [
+        some [
+            copy num to newline skip (
+                last-num: to integer! to text! num
+                sum: sum + last-num
+            )
+        ]
+        end
+    ]
+    close port
+    delete file
+    did all [ok  last-num = 200000  sum = 20000100000]
+)
+
+; TO and THRU go on reading the port until they find a match or its data
+; ends, not just through the input read so far.
+(
+    file: %parse-stream-test.txt
+    write file unspaced [append/dup copy "" "." 300000 "needle" "xyz"]
+    port: open file
+    ok1: did parse port [thru "needle" copy rest to end end]
+    close port
+    port: open file
+    ok2: not parse port [to "missing" to end]
+    close port
+    port: open file
+    ok3: did parse port [to "needle" copy n 6 skip "xyz" end]
+    close port
+    delete file
+    did all [
+        ok1  ok2  ok3
+        rest = to binary! "xyz"
+        n = to binary! "needle"
+    ]
+)
+
+; A mark is a position in the buffer.  Seeking it works after input before it
+; is dropped, but it's an error if the input at the mark was dropped.
+(
+    file: %parse-stream-test.txt
+    dots: append/dup copy "" "." 100000
+    write file unspaced [copy/part dots 65536 "abc" dots]
+    port: open file
+    ok: did parse port [65536 skip pos: [200 skip :pos "abc" | end] to end]
+    close port
+    port: open file
+    e: trap [parse port [pos: 150000 skip :pos to end]]
+    close port
+    delete file
+    did all [ok  e/id = 'parse-dropped]
+)
+
+; Iterated BITSET! rules match a run of characters in one step, so check
+; that long runs, counts and non-ASCII characters give the same results.
+(
+    alpha: charset [#"a" - #"z"]
+    text: append append/dup copy "" "abcXYZ" 100 "é1"
+    did all [
+        parse text [some alpha "é1" end]
+        not parse/case text [some alpha "é1" end]
+        parse text [600 alpha "é1" end]
+        not parse text [601 alpha to end]
+        parse text [2 600 alpha "é1" end]
+        parse text [copy x 599 alpha "Zé1" end]
+        599 = length of x
+        parse to binary! text [some alpha to end]
+        parse/case to binary! "ABCabc" ["ABC" some alpha end]
+        parse append/dup copy "" "aé" 100 [some [alpha | #"é"] end]
+    ]
+)
+
+; TO and THRU on a block of TEXT! alternates search for all of them at once
+; (keeping the searcher when the block is locked).
+(
+    signatures: lock ["ERROR" | "panic:" | "Fatal"]
+    lines: ["ok" "x fatal: y" "z panic: w" "no"]
+    found: copy []
+    for-each line lines [
+        if parse line [thru signatures copy rest to end] [
+            append found rest
+        ]
+    ]
+    did all [
+        found = [": y" " w"]
+        not parse/case "x fatal: y" [thru signatures to end]
+        parse "ERRORS" [to signatures "ERROR" "S" end]
+        parse #{0001020304} [thru [#{0203} | #{01}] #{02} to end]
+    ]
+)
+
+; Rules in nested blocks read and drop input as well.  Input an alternate may
+; go back to is kept, however much the rule before it matched.
+(
+    file: %parse-stream-test.txt
+    write file append/dup copy "" "line^/" 50000
+    n: 0
+    line: [thru newline (n: n + 1)]
+    port: open file
+    ok: did parse port [[[some line] #{78} | some line] end]
+    close port
+    delete file
+    did all [ok  n = 100000]
+)
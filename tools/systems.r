@@ -137,7 +137,7 @@ systems: [
         #SGD #LEN #LLC #F64 #PIP2 <HID> <PIE> /HID /DYN %M %DL ;android
 
     0.4.22 linux-aarch64/linux "libc6-aarch64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 #PTH <HID> /HID /DYN %M %DL %PTH
 
     0.4.30 linux-mips/linux "libc6-mips"
         #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
@@ -146,7 +146,7 @@ systems: [
         #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
 
     0.4.40 linux-x64/linux "libc-x64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #LP64 #PTH <HID> /HID /DYN %M %DL %PTH
 
     0.4.60 linux-axp/linux "dec-alpha"
         #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
@@ -363,6 +363,12 @@ system-definitions: make object! [
     ; intended to be used with the standard compiler for that platform.
     ;
     PIP2: "USE_PIPE2_NOT_PIPE"    ; pipe2() linux only, glibc 2.9 or later
+
+    ; The core can use pthreads for helper work (e.g. the GC sweep).  This is
+    ; not the same as USE_PTHREADS for emscripten, whose threads may not start
+    ; until the main thread yields to the browser.
+    ;
+    PTH: "USE_WORKER_THREADS"
     NSER:                         ; strerror_r() in glibc 2.3.4, not 2.3.0
         "USE_STRERROR_NOT_STRERROR_R"
 ]
@@ -411,6 +417,7 @@ system-libraries: make object! [
     M: <gnu:m>
 
     DL: "dl" ; dynamic lib
+    PTH: "pthread" ; see USE_WORKER_THREADS
     LOG: "log" ; Link with liblog.so on Android
     
     W32: ["wsock32" "comdlg32" "user32" "shell32" "advapi32"]